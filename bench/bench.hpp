@@ -0,0 +1,72 @@
+/// \file bench.hpp
+/// \author Alex Schiffer
+/// \brief Minimal harness for comparing a strongly-typed workload against its
+/// baseline.
+
+#ifndef CINA_BENCH_HPP
+#define CINA_BENCH_HPP
+
+#include <cstddef>    // size_t
+#include <functional> // function
+#include <string>     // string
+#include <utility>    // move
+#include <vector>     // vector
+
+/// \namespace cina_bench
+/// \brief The \c cina_bench namespace contains the benchmark harness.
+namespace cina_bench {
+
+/// \brief Prevents the compiler from optimizing away the computation of \c
+/// value.
+template <typename T> inline auto do_not_optimize(const T& value) -> void {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/// \brief Prevents the compiler from assuming memory is unchanged across the
+/// call.
+inline auto clobber_memory() -> void {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+/// \brief A pair of equivalent workloads whose run times are compared.
+///
+/// \c baseline and \c candidate are called repeatedly and must perform the
+/// same amount of work. Any one-time setup should be done in function-local
+/// statics so that it is absorbed by the warm-up call.
+struct comparison {
+  std::string name;
+  std::function<void()> baseline;
+  std::function<void()> candidate;
+  std::string baseline_label = "raw";
+  std::string candidate_label = "strong";
+};
+
+/// \brief Returns the list of registered comparisons.
+auto registry() -> std::vector<comparison>&;
+
+/// \brief Registers a comparison at static-initialization time.
+struct registrar {
+  explicit registrar(comparison c) { registry().push_back(std::move(c)); }
+};
+
+} // namespace cina_bench
+
+#define CINA_BENCH_CONCAT_IMPL(a, b) a##b
+#define CINA_BENCH_CONCAT(a, b) CINA_BENCH_CONCAT_IMPL(a, b)
+
+/// \brief Registers a comparison of \c baseline against \c candidate under
+/// \c name.
+#define CINA_BENCH_COMPARE(...)                                                \
+  static const ::cina_bench::registrar CINA_BENCH_CONCAT(                      \
+      _cina_bench_registrar_, __LINE__) {                                      \
+    ::cina_bench::comparison { __VA_ARGS__ }                                   \
+  }
+
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Compares updating a counter through std::atomic of the underlying type with
+// the same updates through cina::atomic of a strong type. The saturating
+// counter is compared against a hand-written compare-and-swap loop.
+
+namespace {
+
+using sequence = cina::new_type<struct BenchSequenceTag, std::int64_t>;
+using level = cina::new_type<struct BenchLevelTag, std::int32_t,
+                             cina::addition::with<cina::saturate>>;
+
+constexpr std::size_t update_count = 1 << 14;
+
+auto raw_fetch_add() -> void {
+  static std::atomic<std::int64_t> counter{0};
+  for (std::size_t i = 0; i < update_count; ++i) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  }
+  cina_bench::do_not_optimize(counter.load(std::memory_order_relaxed));
+}
+
+auto strong_fetch_add() -> void {
+  static cina::atomic<sequence> counter{sequence{0}};
+  for (std::size_t i = 0; i < update_count; ++i) {
+    counter.fetch_add(sequence{1}, std::memory_order_relaxed);
+  }
+  cina_bench::do_not_optimize(counter.load(std::memory_order_relaxed));
+}
+
+auto raw_saturating_add() -> void {
+  static std::atomic<std::int32_t> counter{0};
+  for (std::size_t i = 0; i < update_count; ++i) {
+    std::int32_t expected = counter.load(std::memory_order_relaxed);
+    std::int32_t desired = 0;
+    do {
+      desired = static_cast<std::int32_t>(
+          std::min<std::int64_t>(std::int64_t{expected} + 1,
+                                 std::numeric_limits<std::int32_t>::max()));
+    } while (!counter.compare_exchange_weak(expected, desired,
+                                            std::memory_order_relaxed));
+  }
+  cina_bench::do_not_optimize(counter.load(std::memory_order_relaxed));
+}
+
+auto strong_saturating_add() -> void {
+  static cina::atomic<level> counter{level{0}};
+  for (std::size_t i = 0; i < update_count; ++i) {
+    counter.fetch_add(level{1}, std::memory_order_relaxed);
+  }
+  cina_bench::do_not_optimize(counter.load(std::memory_order_relaxed));
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("atomic/fetch_add", raw_fetch_add, strong_fetch_add);
+CINA_BENCH_COMPARE("atomic/saturating_fetch_add", raw_saturating_add,
+                   strong_saturating_add, "cas_loop", "strong");
@@ -0,0 +1,98 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Workloads that are built without optimization to track how much slower
+// strong types are than raw integers in debug builds, where every operator
+// that is not inlined costs a call.
+
+namespace {
+
+using raw_integer = std::int32_t;
+using strong_integer = cina::new_type<struct BenchDebugIntegerTag, std::int32_t>;
+using raw_sample = std::int16_t;
+using strong_sample =
+    cina::new_type<struct BenchDebugSampleTag, std::int16_t,
+                   cina::preserve_width<cina::saturate>>;
+
+constexpr std::size_t value_count = 1 << 12;
+
+template <typename T, typename U>
+auto make_values(const U low, const U high) -> std::vector<T> {
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<int> distribution{low, high};
+  std::vector<T> values;
+  values.reserve(value_count);
+  for (std::size_t i = 0; i < value_count; ++i) {
+    values.push_back(T{static_cast<U>(distribution(engine))});
+  }
+  return values;
+}
+
+template <typename T> auto integers() -> const std::vector<T>& {
+  static const std::vector<T> values =
+      make_values<T, raw_integer>(1, 1 << 20);
+  return values;
+}
+
+template <typename T> auto samples() -> const std::vector<T>& {
+  static const std::vector<T> values = make_values<T, raw_sample>(-100, 100);
+  return values;
+}
+
+template <typename T> auto arithmetic() -> void {
+  const auto& in = integers<T>();
+  static std::vector<T> out(value_count, T{0});
+  const T k{7};
+  const T m{1'000'003};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    out[i] = (in[i] * k + in[i] - k) / k % m;
+  }
+  cina_bench::do_not_optimize(out.data());
+}
+
+template <typename T> auto reduce() -> void {
+  const auto& in = integers<T>();
+  T sum{0};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    sum += in[i];
+    ++sum;
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto raw_saturating_add() -> void {
+  const auto& in = samples<raw_sample>();
+  constexpr int min = std::numeric_limits<raw_sample>::min();
+  constexpr int max = std::numeric_limits<raw_sample>::max();
+  raw_sample sum{0};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const int wide = sum + in[i];
+    sum = static_cast<raw_sample>(wide < min ? min : wide > max ? max : wide);
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto strong_saturating_add() -> void {
+  const auto& in = samples<strong_sample>();
+  strong_sample sum{raw_sample{0}};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    sum += in[i];
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("debug/mul_add_div_mod", arithmetic<raw_integer>,
+                   arithmetic<strong_integer>);
+CINA_BENCH_COMPARE("debug/reduce", reduce<raw_integer>,
+                   reduce<strong_integer>);
+CINA_BENCH_COMPARE("debug/saturating_add", raw_saturating_add,
+                   strong_saturating_add);
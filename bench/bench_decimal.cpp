@@ -0,0 +1,94 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Compares decimal prices against the int64_t cents and double values they
+// replace. Sums must vectorize exactly like the integer baseline.
+
+namespace {
+
+constexpr std::size_t price_count = 1 << 20;
+constexpr std::size_t text_count = 1 << 12;
+
+using price = cina::decimal<struct BenchPriceTag, 18, 2>;
+
+auto raw_prices() -> const std::vector<std::int64_t>& {
+  static const std::vector<std::int64_t> data = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::int64_t> distribution{1, 10'000'000};
+    std::vector<std::int64_t> result(price_count);
+    for (std::int64_t& value : result) {
+      value = distribution(engine);
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto raw_sum() -> void {
+  std::int64_t sum = 0;
+  for (const std::int64_t& value : raw_prices()) {
+    sum += value;
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto strong_sum() -> void {
+  static const std::vector<price> data = [] {
+    std::vector<price> result;
+    result.reserve(price_count);
+    for (const std::int64_t value : raw_prices()) {
+      result.push_back(price::from_raw(value));
+    }
+    return result;
+  }();
+  price sum{0};
+  for (const price& value : data) {
+    sum += value;
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto double_to_chars() -> void {
+  static const std::vector<double> data = [] {
+    std::vector<double> result;
+    result.reserve(text_count);
+    for (std::size_t i = 0; i < text_count; ++i) {
+      result.push_back(static_cast<double>(raw_prices()[i]) / 100.0);
+    }
+    return result;
+  }();
+  std::array<char, 64> buffer{};
+  std::size_t length = 0;
+  for (const double value : data) {
+    const auto result =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+                      std::chars_format::fixed, 2);
+    length += static_cast<std::size_t>(result.ptr - buffer.data());
+  }
+  cina_bench::do_not_optimize(length);
+}
+
+auto decimal_to_chars() -> void {
+  std::array<char, price::max_chars> buffer{};
+  std::size_t length = 0;
+  for (std::size_t i = 0; i < text_count; ++i) {
+    const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(),
+                                 price::from_raw(raw_prices()[i]));
+    length += static_cast<std::size_t>(result.ptr - buffer.data());
+  }
+  cina_bench::do_not_optimize(length);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("decimal/sum", raw_sum, strong_sum, "int64_t", "decimal");
+CINA_BENCH_COMPARE("decimal/to_chars", double_to_chars, decimal_to_chars,
+                   "double", "decimal");
@@ -0,0 +1,74 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+// Compares enumeration::from_string against the linear search over a name
+// table that hand-written decoders use.
+
+namespace {
+
+constexpr std::size_t lookup_count = 1 << 12;
+
+enum class message : std::uint16_t {
+  logon, logout, heartbeat, test_request, resend_request, reject,
+  sequence_reset, execution_report, order_cancel_reject, new_order_single,
+  order_cancel_request, order_cancel_replace_request, order_status_request,
+  allocation, list_cancel_request, list_execute, list_status_request,
+  list_status, allocation_ack, dont_know_trade, quote_request, quote,
+  settlement_instructions, market_data_request, market_data_snapshot,
+  market_data_incremental_refresh, market_data_request_reject,
+  quote_cancel, quote_status_request, mass_quote_acknowledgement,
+  security_definition_request, security_definition
+};
+
+using message_type = cina::enumeration<struct BenchMessageTag, message>;
+
+auto inputs() -> const std::vector<std::string_view>& {
+  static const std::vector<std::string_view> data = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::size_t> distribution{
+        0, message_type::size - 1};
+    std::vector<std::string_view> result;
+    result.reserve(lookup_count);
+    for (std::size_t i = 0; i < lookup_count; ++i) {
+      result.push_back(message_type::names()[distribution(engine)]);
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto linear_lookup() -> void {
+  const auto names = message_type::names();
+  std::size_t sum = 0;
+  for (const std::string_view input : inputs()) {
+    for (std::size_t pos = 0; pos < names.size(); ++pos) {
+      if (names[pos] == input) {
+        sum += pos;
+        break;
+      }
+    }
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto hashed_lookup() -> void {
+  std::size_t sum = 0;
+  for (const std::string_view input : inputs()) {
+    if (const auto value = message_type::from_string(input)) {
+      sum += value->pos();
+    }
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("enumeration/from_string/32_names", linear_lookup,
+                   hashed_lookup, "linear", "perfect");
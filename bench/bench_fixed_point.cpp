@@ -0,0 +1,72 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Compares a Q16.16 FIR filter against the same filter in float. Both filters
+// read the same samples and coefficients, quantized once at setup.
+
+namespace {
+
+constexpr std::size_t sample_count = 1 << 14;
+constexpr std::size_t tap_count = 32;
+
+using sample = cina::fixed_point<struct BenchSampleTag, std::int32_t, 16>;
+
+auto float_samples() -> const std::vector<float>& {
+  static const std::vector<float> data = [] {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+    std::vector<float> result(sample_count + tap_count);
+    for (float& value : result) {
+      value = distribution(engine);
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto float_taps() -> const std::vector<float>& {
+  static const std::vector<float> data = [] {
+    std::vector<float> result(tap_count);
+    for (std::size_t k = 0; k < tap_count; ++k) {
+      result[k] = 1.0F / static_cast<float>(tap_count + k);
+    }
+    return result;
+  }();
+  return data;
+}
+
+template <typename T> auto convert(const std::vector<float>& in)
+    -> std::vector<T> {
+  std::vector<T> result;
+  result.reserve(in.size());
+  for (const float value : in) {
+    result.push_back(T{value});
+  }
+  return result;
+}
+
+template <typename T> auto fir() -> void {
+  static const std::vector<T> in = convert<T>(float_samples());
+  static const std::vector<T> taps = convert<T>(float_taps());
+  static std::vector<T> out(sample_count, T{0});
+  for (std::size_t n = 0; n < sample_count; ++n) {
+    T acc{0};
+    for (std::size_t k = 0; k < tap_count; ++k) {
+      acc += in[n + k] * taps[k];
+    }
+    out[n] = acc;
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("fixed_point/fir/q16_16", fir<float>, fir<sample>, "float",
+                   "fixed");
@@ -0,0 +1,96 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Compares the bulk kernels of flags against the loops over raw uint64_t
+// masks that they replace. The raw count uses std::popcount, which is a
+// library call unless the target has a popcount instruction.
+
+namespace {
+
+constexpr std::size_t mask_count = 1 << 14;
+
+enum class feature : std::uint8_t {
+  f00, f01, f02, f03, f04, f05, f06, f07, f08, f09, f10, f11, f12, f13, f14,
+  f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+  f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+  f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59,
+  f60, f61, f62, f63
+};
+
+using features = cina::flags<struct BenchFeatureTag, feature>;
+
+auto random_masks(const std::uint64_t seed) -> std::vector<std::uint64_t> {
+  std::mt19937_64 engine{seed};
+  std::vector<std::uint64_t> result(mask_count);
+  for (std::uint64_t& mask : result) {
+    mask = engine();
+  }
+  return result;
+}
+
+auto to_flags(const std::vector<std::uint64_t>& masks)
+    -> std::vector<features> {
+  std::vector<features> result;
+  result.reserve(masks.size());
+  for (const std::uint64_t mask : masks) {
+    result.push_back(features::from_raw(mask));
+  }
+  return result;
+}
+
+// All buffers are allocated together so that their relative placement is the
+// same for both workloads.
+struct buffers {
+  std::vector<std::uint64_t> raw_lhs = random_masks(1);
+  std::vector<std::uint64_t> raw_rhs = random_masks(2);
+  std::vector<std::uint64_t> raw_out = std::vector<std::uint64_t>(mask_count);
+  std::vector<features> strong_lhs = to_flags(raw_lhs);
+  std::vector<features> strong_rhs = to_flags(raw_rhs);
+  std::vector<features> strong_out = std::vector<features>(mask_count);
+};
+
+auto data() -> buffers& {
+  static buffers instance;
+  return instance;
+}
+
+auto raw_or() -> void {
+  buffers& d = data();
+  for (std::size_t i = 0; i < mask_count; ++i) {
+    d.raw_out[i] = d.raw_lhs[i] | d.raw_rhs[i];
+  }
+  cina_bench::do_not_optimize(d.raw_out.data());
+  cina_bench::clobber_memory();
+}
+
+auto strong_or() -> void {
+  buffers& d = data();
+  features::bulk_or(d.strong_lhs, d.strong_rhs, d.strong_out);
+  cina_bench::do_not_optimize(d.strong_out.data());
+  cina_bench::clobber_memory();
+}
+
+auto raw_count() -> void {
+  std::size_t total = 0;
+  for (const std::uint64_t mask : data().raw_lhs) {
+    total += static_cast<std::size_t>(std::popcount(mask));
+  }
+  cina_bench::do_not_optimize(total);
+}
+
+auto strong_count() -> void {
+  const std::size_t total = features::bulk_count(data().strong_lhs);
+  cina_bench::do_not_optimize(total);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("flags/bulk_or/64", raw_or, strong_or);
+CINA_BENCH_COMPARE("flags/bulk_count/64", raw_count, strong_count);
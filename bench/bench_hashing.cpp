@@ -0,0 +1,67 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Compares the identity std::hash of a plain strong integer against the
+// hashing skill in a linear-probing table that selects buckets with the low
+// bits of the hash. Sequential keys are the best case for the identity hash;
+// strided keys all collide in the low bits and degrade it to a linear scan.
+
+namespace {
+
+using identity_id = cina::new_type<struct BenchIdentityIdTag, std::int64_t>;
+using mixed_id = cina::new_type<struct BenchMixedIdTag, std::int64_t,
+                                cina::equality_comparison, cina::hashing>;
+
+constexpr std::size_t key_count = 1 << 12;
+constexpr std::size_t table_size = key_count * 2;
+constexpr std::int64_t stride = 1 << 12;
+
+template <typename Key> class open_addressing_set {
+public:
+  open_addressing_set() : _slots(table_size, Key{-1}) {}
+
+  auto insert(const Key key) -> void { _slots[find(key)] = key; }
+
+  [[nodiscard]] auto contains(const Key key) const -> bool {
+    return _slots[find(key)] == key;
+  }
+
+private:
+  [[nodiscard]] auto find(const Key key) const -> std::size_t {
+    std::size_t index = std::hash<Key>{}(key) & (table_size - 1);
+    while (_slots[index] != key && _slots[index] != Key{-1}) {
+      index = (index + 1) & (table_size - 1);
+    }
+    return index;
+  }
+
+  std::vector<Key> _slots;
+};
+
+template <typename Key, std::int64_t Stride> auto insert_and_find() -> void {
+  open_addressing_set<Key> set;
+  for (std::size_t i = 0; i < key_count; ++i) {
+    set.insert(Key{static_cast<std::int64_t>(i) * Stride});
+  }
+  std::size_t found = 0;
+  for (std::size_t i = 0; i < key_count; ++i) {
+    found += set.contains(Key{static_cast<std::int64_t>(i) * Stride}) ? 1 : 0;
+  }
+  cina_bench::do_not_optimize(found);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("hashing/open_addressing/sequential",
+                   insert_and_find<identity_id, 1>,
+                   insert_and_find<mixed_id, 1>, "identity", "splitmix64");
+CINA_BENCH_COMPARE("hashing/open_addressing/strided",
+                   insert_and_find<identity_id, stride>,
+                   insert_and_find<mixed_id, stride>, "identity",
+                   "splitmix64");
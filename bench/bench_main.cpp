@@ -0,0 +1,89 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+namespace cina_bench {
+
+auto registry() -> std::vector<comparison>& {
+  static std::vector<comparison> comparisons;
+  return comparisons;
+}
+
+namespace {
+
+using bench_clock = std::chrono::steady_clock;
+
+constexpr auto min_batch_time = std::chrono::milliseconds(20);
+constexpr int repetitions = 7;
+
+// Returns the fastest observed time per call in nanoseconds.
+auto measure(const std::function<void()>& workload) -> double {
+  workload();
+
+  std::size_t iterations = 1;
+  for (;;) {
+    const auto start = bench_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      workload();
+    }
+    if (bench_clock::now() - start >= min_batch_time) {
+      break;
+    }
+    iterations *= 2;
+  }
+
+  double best = 0.0;
+  for (int r = 0; r < repetitions; ++r) {
+    const auto start = bench_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      workload();
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        bench_clock::now() - start;
+    const double per_call = elapsed.count() / static_cast<double>(iterations);
+    best = r == 0 ? per_call : std::min(best, per_call);
+  }
+  return best;
+}
+
+} // namespace
+} // namespace cina_bench
+
+auto main(int argc, char** argv) -> int {
+  std::string_view filter;
+  double max_ratio = 0.0;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with("--filter=")) {
+      filter = arg.substr(9);
+    } else if (arg.starts_with("--max-ratio=")) {
+      max_ratio = std::strtod(argv[i] + 12, nullptr);
+    } else {
+      std::fprintf(stderr, "usage: %s [--filter=<substr>] [--max-ratio=<r>]\n",
+                   argv[0]);
+      return 2;
+    }
+  }
+
+  std::printf("%-48s %-22s %-22s %8s\n", "benchmark", "baseline (ns)",
+              "candidate (ns)", "ratio");
+  int regressions = 0;
+  for (const auto& c : cina_bench::registry()) {
+    if (!filter.empty() && c.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    const double baseline = cina_bench::measure(c.baseline);
+    const double candidate = cina_bench::measure(c.candidate);
+    const double ratio = candidate / baseline;
+    const bool regressed = max_ratio > 0.0 && ratio > max_ratio;
+    regressions += regressed ? 1 : 0;
+    std::printf("%-48s %-10s %11.1f %-10s %11.1f %8.3f%s\n", c.name.c_str(),
+                c.baseline_label.c_str(), baseline, c.candidate_label.c_str(),
+                candidate, ratio, regressed ? "  <-- regression" : "");
+  }
+  return regressions == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Compares modular_integer against the usual % on raw integers. The ring
+// buffer baselines keep the capacity in a variable, as a ring buffer class
+// does, so the raw % is a hardware divide.
+
+namespace {
+
+constexpr std::size_t step_count = 1 << 16;
+constexpr std::uint32_t ring_size = 1024;
+constexpr std::uint32_t odd_ring_size = 1000;
+constexpr std::uint32_t prime_modulus = 1'000'000'007;
+
+using slot = cina::modular_integer<struct BenchSlotTag, ring_size>;
+using odd_slot = cina::modular_integer<struct BenchOddSlotTag, odd_ring_size>;
+using residue = cina::modular_integer<struct BenchResidueTag, prime_modulus>;
+
+template <std::uint32_t Capacity> auto raw_ring() -> void {
+  static std::vector<std::uint32_t> buffer(Capacity);
+  volatile std::uint32_t capacity_source = Capacity;
+  const std::uint32_t capacity = capacity_source;
+  std::uint32_t head = 0;
+  for (std::size_t i = 0; i < step_count; ++i) {
+    buffer[head] += 1;
+    head = (head + 7) % capacity;
+  }
+  cina_bench::do_not_optimize(buffer.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename Slot> auto strong_ring() -> void {
+  static std::vector<std::uint32_t> buffer(Slot::modulus);
+  Slot head = Slot::first();
+  const Slot stride{7};
+  for (std::size_t i = 0; i < step_count; ++i) {
+    buffer[head.unwrap()] += 1;
+    head += stride;
+  }
+  cina_bench::do_not_optimize(buffer.data());
+  cina_bench::clobber_memory();
+}
+
+auto raw_values() -> const std::vector<std::uint32_t>& {
+  static const std::vector<std::uint32_t> data = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::uint32_t> distribution{
+        0, prime_modulus - 1};
+    std::vector<std::uint32_t> result(step_count);
+    for (std::uint32_t& value : result) {
+      value = distribution(engine);
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto raw_product() -> void {
+  volatile std::uint64_t modulus_source = prime_modulus;
+  const std::uint64_t modulus = modulus_source;
+  std::uint64_t product = 1;
+  for (const std::uint32_t value : raw_values()) {
+    product = product * value % modulus;
+  }
+  cina_bench::do_not_optimize(product);
+}
+
+auto strong_product() -> void {
+  static const std::vector<residue> data = [] {
+    std::vector<residue> result;
+    result.reserve(step_count);
+    for (const std::uint32_t value : raw_values()) {
+      result.push_back(residue{value});
+    }
+    return result;
+  }();
+  residue product{1};
+  for (const residue value : data) {
+    product *= value;
+  }
+  cina_bench::do_not_optimize(product);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("modular/ring_advance/pow2", raw_ring<ring_size>,
+                   strong_ring<slot>, "raw %", "modular");
+CINA_BENCH_COMPARE("modular/ring_advance/non_pow2", raw_ring<odd_ring_size>,
+                   strong_ring<odd_slot>, "raw %", "modular");
+CINA_BENCH_COMPARE("modular/product/prime", raw_product, strong_product,
+                   "raw %", "modular");
@@ -0,0 +1,183 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// The overflow-policy comparisons use a wrapping loop over the raw type as the
+// baseline. The saturating and wrapping policies are expected to vectorize
+// just like the baseline and so run at a ratio close to one. Inputs are drawn
+// from half the range of the type so that the trapping policy never fires;
+// the policies are branch-free, so their cost does not depend on whether an
+// operation overflows.
+
+namespace {
+
+template <typename T, typename Policy>
+using policy_integer =
+    cina::new_type<struct BenchOverflowTag, T, cina::addition::with<Policy>,
+                   cina::subtraction::with<Policy>>;
+
+constexpr std::size_t overflow_size = 1 << 16;
+
+template <typename T> auto raw_values() -> const std::vector<T>& {
+  static const std::vector<T> data = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::int64_t> distribution{
+        std::numeric_limits<T>::min() / 2, std::numeric_limits<T>::max() / 2};
+    std::vector<T> result(overflow_size);
+    for (T& value : result) {
+      value = static_cast<T>(distribution(engine));
+    }
+    return result;
+  }();
+  return data;
+}
+
+template <typename T> auto values() -> const std::vector<T>& {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return raw_values<T>();
+  } else {
+    using raw_type = std::remove_cvref_t<cina::underlying_type_t<T>>;
+    static const std::vector<T> data = [] {
+      const auto& raw = raw_values<raw_type>();
+      std::vector<T> result;
+      result.reserve(raw.size());
+      for (const raw_type value : raw) {
+        result.push_back(T{value});
+      }
+      return result;
+    }();
+    return data;
+  }
+}
+
+template <typename T> auto raw_add() -> void {
+  using unsigned_type = std::make_unsigned_t<T>;
+  const auto& lhs = raw_values<T>();
+  static std::vector<T> out(overflow_size);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    const std::size_t j = lhs.size() - 1 - i;
+    out[i] = static_cast<T>(static_cast<unsigned_type>(lhs[i]) +
+                            static_cast<unsigned_type>(lhs[j]));
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto add() -> void {
+  const auto& lhs = values<T>();
+  static std::vector<T> out = lhs;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    const std::size_t j = lhs.size() - 1 - i;
+    out[i] = lhs[i] + lhs[j];
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto raw_saturating_subtract() -> void {
+  const auto& lhs = raw_values<T>();
+  static std::vector<T> out(overflow_size);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    const std::size_t j = lhs.size() - 1 - i;
+    const auto wide = static_cast<std::int64_t>(lhs[i]) - lhs[j];
+    out[i] = static_cast<T>(std::clamp<std::int64_t>(
+        wide, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto subtract() -> void {
+  const auto& lhs = values<T>();
+  static std::vector<T> out = lhs;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    const std::size_t j = lhs.size() - 1 - i;
+    out[i] = lhs[i] - lhs[j];
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+// The width comparisons compute (a + b) * (a - b) over 8- and 16-bit arrays.
+// The default skills promote to int, so the baseline produces 32-bit results
+// and runs in 32-bit lanes. With preserve_width the wrapping loop stays in
+// narrow lanes. The saturating loop still clamps the exact product in 32-bit
+// lanes, which without SSE4.1 costs more than the baseline.
+template <typename T>
+using promoting_integer = cina::new_type<struct BenchWidthTag, T>;
+
+template <typename T, typename Policy>
+using narrow_integer =
+    cina::new_type<struct BenchWidthTag, T, cina::preserve_width<Policy>>;
+
+template <typename T> auto difference_of_squares() -> void {
+  using sum_type = decltype(std::declval<T>() + std::declval<T>());
+  using result_type =
+      decltype(std::declval<sum_type>() * std::declval<sum_type>());
+  const auto& in = values<T>();
+  static std::vector<result_type> out = [] {
+    using raw_type = std::remove_cvref_t<cina::underlying_type_t<result_type>>;
+    return std::vector<result_type>(overflow_size, result_type{raw_type{0}});
+  }();
+  const std::size_t half = in.size() / 2;
+  for (std::size_t i = 0; i < half; ++i) {
+    const std::size_t j = i + half;
+    out[i] = (in[i] + in[j]) * (in[i] - in[j]);
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("overflow/int16/add/saturate", raw_add<std::int16_t>,
+                   add<policy_integer<std::int16_t, cina::saturate>>,
+                   "raw wrap", "saturate");
+CINA_BENCH_COMPARE("overflow/int16/add/wrap", raw_add<std::int16_t>,
+                   add<policy_integer<std::int16_t, cina::wrap>>, "raw wrap",
+                   "wrap");
+CINA_BENCH_COMPARE("overflow/int32/add/saturate", raw_add<std::int32_t>,
+                   add<policy_integer<std::int32_t, cina::saturate>>,
+                   "raw wrap", "saturate");
+CINA_BENCH_COMPARE("overflow/int32/add/wrap", raw_add<std::int32_t>,
+                   add<policy_integer<std::int32_t, cina::wrap>>, "raw wrap",
+                   "wrap");
+CINA_BENCH_COMPARE("overflow/int32/add/trap", raw_add<std::int32_t>,
+                   add<policy_integer<std::int32_t, cina::trap>>, "raw wrap",
+                   "trap");
+CINA_BENCH_COMPARE("overflow/int16/subtract/saturate",
+                   raw_saturating_subtract<std::int16_t>,
+                   subtract<policy_integer<std::int16_t, cina::saturate>>,
+                   "raw clamp", "saturate");
+CINA_BENCH_COMPARE("overflow/int32/subtract/saturate",
+                   raw_saturating_subtract<std::int32_t>,
+                   subtract<policy_integer<std::int32_t, cina::saturate>>,
+                   "raw clamp", "saturate");
+CINA_BENCH_COMPARE(
+    "width/int8/difference_of_squares/wrap",
+    difference_of_squares<promoting_integer<std::int8_t>>,
+    difference_of_squares<narrow_integer<std::int8_t, cina::wrap>>,
+    "promoting", "wrap");
+CINA_BENCH_COMPARE(
+    "width/int8/difference_of_squares/saturate",
+    difference_of_squares<promoting_integer<std::int8_t>>,
+    difference_of_squares<narrow_integer<std::int8_t, cina::saturate>>,
+    "promoting", "saturate");
+CINA_BENCH_COMPARE(
+    "width/int16/difference_of_squares/wrap",
+    difference_of_squares<promoting_integer<std::int16_t>>,
+    difference_of_squares<narrow_integer<std::int16_t, cina::wrap>>,
+    "promoting", "wrap");
+CINA_BENCH_COMPARE(
+    "width/int16/difference_of_squares/saturate",
+    difference_of_squares<promoting_integer<std::int16_t>>,
+    difference_of_squares<narrow_integer<std::int16_t, cina::saturate>>,
+    "promoting", "saturate");
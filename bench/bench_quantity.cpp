@@ -0,0 +1,85 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <ratio>
+#include <vector>
+
+// Compares converting speeds with a quantity, where the factor is a
+// compile-time constant, against the usual conversion function that looks
+// the factors up at run time.
+
+namespace {
+
+constexpr std::size_t sample_count = 1 << 14;
+
+using kilometres_per_hour =
+    cina::quantity<cina::dimensions::velocity, std::ratio<5, 18>>;
+using metres_per_second = cina::quantity<cina::dimensions::velocity>;
+
+enum class speed_unit { metres_per_second, kilometres_per_hour, knots };
+
+constexpr std::array<double, 3> to_si{1.0, 1000.0 / 3600.0, 1852.0 / 3600.0};
+
+[[gnu::noinline]] auto convert(const double value, const speed_unit from,
+                               const speed_unit to) -> double {
+  return value * to_si[static_cast<std::size_t>(from)] /
+         to_si[static_cast<std::size_t>(to)];
+}
+
+// All buffers are allocated together so that their relative placement is the
+// same for both workloads.
+struct buffers {
+  std::vector<double> raw_in = [] {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<double> distribution{0.0, 300.0};
+    std::vector<double> result(sample_count);
+    for (double& value : result) {
+      value = distribution(engine);
+    }
+    return result;
+  }();
+  std::vector<double> raw_out = std::vector<double>(sample_count);
+  std::vector<kilometres_per_hour> strong_in = [this] {
+    std::vector<kilometres_per_hour> result;
+    result.reserve(sample_count);
+    for (const double value : raw_in) {
+      result.emplace_back(value);
+    }
+    return result;
+  }();
+  std::vector<metres_per_second> strong_out =
+      std::vector<metres_per_second>(sample_count, metres_per_second{0.0});
+};
+
+auto data() -> buffers& {
+  static buffers instance;
+  return instance;
+}
+
+auto runtime_convert() -> void {
+  buffers& d = data();
+  for (std::size_t i = 0; i < sample_count; ++i) {
+    d.raw_out[i] = convert(d.raw_in[i], speed_unit::kilometres_per_hour,
+                           speed_unit::metres_per_second);
+  }
+  cina_bench::do_not_optimize(d.raw_out.data());
+  cina_bench::clobber_memory();
+}
+
+auto quantity_convert() -> void {
+  buffers& d = data();
+  for (std::size_t i = 0; i < sample_count; ++i) {
+    d.strong_out[i] = d.strong_in[i];
+  }
+  cina_bench::do_not_optimize(d.strong_out.data());
+  cina_bench::clobber_memory();
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("quantity/convert/kmh_to_ms", runtime_convert,
+                   quantity_convert, "runtime", "quantity");
@@ -0,0 +1,60 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Compares incrementing one std::atomic from a growing number of threads with
+// incrementing a sharded_counter. Every thread performs the same number of
+// relaxed increments, so the ratio shows how the contention scales.
+
+namespace {
+
+using requests = cina::new_type<struct BenchRequestsTag, std::int64_t>;
+
+constexpr std::size_t increments_per_thread = 1 << 14;
+
+template <typename Increment>
+auto run_threads(const std::size_t thread_count, const Increment increment)
+    -> void {
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([increment] {
+      for (std::size_t i = 0; i < increments_per_thread; ++i) {
+        increment();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+template <std::size_t ThreadCount> auto single_atomic() -> void {
+  static std::atomic<std::int64_t> counter{0};
+  run_threads(ThreadCount,
+              [] { counter.fetch_add(1, std::memory_order_relaxed); });
+  cina_bench::do_not_optimize(counter.load(std::memory_order_relaxed));
+}
+
+template <std::size_t ThreadCount> auto sharded() -> void {
+  static cina::sharded_counter<requests> counter;
+  run_threads(ThreadCount, [] { counter.increment(); });
+  cina_bench::do_not_optimize(counter.load());
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("sharded_counter/threads_1", single_atomic<1>, sharded<1>,
+                   "atomic", "sharded");
+CINA_BENCH_COMPARE("sharded_counter/threads_4", single_atomic<4>, sharded<4>,
+                   "atomic", "sharded");
+CINA_BENCH_COMPARE("sharded_counter/threads_16", single_atomic<16>,
+                   sharded<16>, "atomic", "sharded");
+CINA_BENCH_COMPARE("sharded_counter/threads_64", single_atomic<64>,
+                   sharded<64>, "atomic", "sharded");
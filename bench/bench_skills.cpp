@@ -0,0 +1,129 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using raw_integer = std::int32_t;
+using strong_integer = cina::new_type<struct BenchIntegerTag, std::int32_t>;
+using strong_boolean = cina::new_type<struct BenchBooleanTag, bool>;
+
+constexpr std::size_t arithmetic_size = 1 << 16;
+constexpr std::size_t sort_size = 1 << 14;
+constexpr std::size_t hash_size = 1 << 14;
+
+template <typename T> auto make_values(const std::size_t size) -> std::vector<T> {
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<raw_integer> distribution{1, 1 << 20};
+  std::vector<T> values;
+  values.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    values.push_back(T{distribution(engine)});
+  }
+  return values;
+}
+
+// One cache per element type and size, so each benchmark sees the number of
+// values its size constant names.
+template <typename T, std::size_t Size> auto values() -> std::vector<T>& {
+  static std::vector<T> data = make_values<T>(Size);
+  return data;
+}
+
+template <typename T> auto reduce() -> void {
+  const auto& in = values<T, arithmetic_size>();
+  T sum{0};
+  for (const T& value : in) {
+    sum += value;
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+template <typename T> auto arithmetic() -> void {
+  const auto& in = values<T, arithmetic_size>();
+  static std::vector<T> out(arithmetic_size, T{0});
+  const T k{7};
+  const T m{1'000'003};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    out[i] = (in[i] * k + in[i] - k) / k % m;
+  }
+  cina_bench::do_not_optimize(out.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto increment() -> void {
+  static std::vector<T> data = make_values<T>(arithmetic_size);
+  for (T& value : data) {
+    ++value;
+  }
+  cina_bench::do_not_optimize(data.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto sort() -> void {
+  const auto& in = values<T, sort_size>();
+  static std::vector<T> scratch = in;
+  std::copy(in.begin(), in.end(), scratch.begin());
+  std::sort(scratch.begin(), scratch.end());
+  cina_bench::do_not_optimize(scratch.data());
+  cina_bench::clobber_memory();
+}
+
+template <typename T> auto hash_map() -> void {
+  const auto& in = values<T, hash_size>();
+  std::unordered_map<T, std::size_t> map;
+  map.reserve(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    map.emplace(in[i], i);
+  }
+  std::size_t found = 0;
+  for (const T& value : in) {
+    found += map.count(value);
+  }
+  cina_bench::do_not_optimize(found);
+}
+
+template <typename T> auto booleans() -> const T* {
+  static const T* const data = [] {
+    std::mt19937 engine{42};
+    std::bernoulli_distribution distribution{0.5};
+    T* result = std::allocator<T>{}.allocate(arithmetic_size);
+    for (std::size_t i = 0; i < arithmetic_size; ++i) {
+      std::construct_at(result + i, distribution(engine));
+    }
+    return result;
+  }();
+  return data;
+}
+
+template <typename T> auto count_true() -> void {
+  const T* in = booleans<T>();
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < arithmetic_size; ++i) {
+    count += in[i] ? 1 : 0;
+  }
+  cina_bench::do_not_optimize(count);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("signed_integer/reduce", reduce<raw_integer>,
+                   reduce<strong_integer>);
+CINA_BENCH_COMPARE("signed_integer/mul_add_div_mod", arithmetic<raw_integer>,
+                   arithmetic<strong_integer>);
+CINA_BENCH_COMPARE("signed_integer/increment", increment<raw_integer>,
+                   increment<strong_integer>);
+CINA_BENCH_COMPARE("signed_integer/sort", sort<raw_integer>,
+                   sort<strong_integer>);
+CINA_BENCH_COMPARE("signed_integer/unordered_map", hash_map<raw_integer>,
+                   hash_map<strong_integer>);
+CINA_BENCH_COMPARE("boolean/count_true", count_true<bool>,
+                   count_true<strong_boolean>);
\ No newline at end of file
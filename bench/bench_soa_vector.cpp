@@ -0,0 +1,99 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+// Compares summing one field of a table of records stored as an array of
+// structs with the same scan over the column of a soa_vector, and the column
+// scan with the same scan over a raw array.
+
+namespace {
+
+using order_id = cina::new_type<struct BenchOrderIdTag, std::int32_t>;
+using price = cina::new_type<struct BenchPriceTag, std::int32_t>;
+using quantity = cina::new_type<struct BenchQuantityTag, std::int32_t>;
+using timestamp = cina::new_type<struct BenchTimestampTag, std::int64_t>;
+
+struct order {
+  order_id id;
+  price cost;
+  quantity amount;
+  timestamp time;
+};
+
+using order_table = cina::soa_vector<order_id, price, quantity, timestamp>;
+
+constexpr std::size_t row_count = 1 << 16;
+
+auto raw_prices() -> const std::vector<std::int32_t>& {
+  static const std::vector<std::int32_t> prices = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::int32_t> distribution{1, 1000};
+    std::vector<std::int32_t> result(row_count);
+    for (std::int32_t& value : result) {
+      value = distribution(engine);
+    }
+    return result;
+  }();
+  return prices;
+}
+
+auto records() -> const std::vector<order>& {
+  static const std::vector<order> result = [] {
+    std::vector<order> rows;
+    rows.reserve(row_count);
+    for (std::size_t i = 0; i < row_count; ++i) {
+      const auto index = static_cast<std::int32_t>(i);
+      rows.push_back(order{order_id{index}, price{raw_prices()[i]},
+                           quantity{index % 10}, timestamp{index}});
+    }
+    return rows;
+  }();
+  return result;
+}
+
+auto table() -> const order_table& {
+  static const order_table result = [] {
+    order_table rows;
+    rows.reserve(row_count);
+    for (const order& row : records()) {
+      rows.push_back(row.id, row.cost, row.amount, row.time);
+    }
+    return rows;
+  }();
+  return result;
+}
+
+auto raw_scan() -> void {
+  std::int32_t total = 0;
+  for (const std::int32_t value : raw_prices()) {
+    total += value;
+  }
+  cina_bench::do_not_optimize(total);
+}
+
+auto aos_scan() -> void {
+  price total{0};
+  for (const order& row : records()) {
+    total += row.cost;
+  }
+  cina_bench::do_not_optimize(total);
+}
+
+auto soa_scan() -> void {
+  price total{0};
+  for (const price& value : table().column<price>()) {
+    total += value;
+  }
+  cina_bench::do_not_optimize(total);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("soa_vector/column_sum", raw_scan, soa_scan);
+CINA_BENCH_COMPARE("soa_vector/field_sum", aos_scan, soa_scan, "aos", "soa");
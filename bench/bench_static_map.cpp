@@ -0,0 +1,88 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Compares looking up a routing table built into a std::unordered_map at
+// startup with a static_map built at compile time. One lookup in eight misses.
+
+namespace {
+
+using route_id = cina::new_type<struct BenchRouteTag, std::uint32_t>;
+using handler_id = cina::new_type<struct BenchHandlerTag, std::int32_t>;
+
+constexpr std::size_t lookup_count = 1 << 14;
+
+using static_routes = cina::static_map<
+    route_id, handler_id, cina::map_entry{route_id{21U}, handler_id{1}},
+    cina::map_entry{route_id{22U}, handler_id{2}},
+    cina::map_entry{route_id{25U}, handler_id{3}},
+    cina::map_entry{route_id{53U}, handler_id{4}},
+    cina::map_entry{route_id{80U}, handler_id{5}},
+    cina::map_entry{route_id{110U}, handler_id{6}},
+    cina::map_entry{route_id{143U}, handler_id{7}},
+    cina::map_entry{route_id{443U}, handler_id{8}},
+    cina::map_entry{route_id{465U}, handler_id{9}},
+    cina::map_entry{route_id{587U}, handler_id{10}},
+    cina::map_entry{route_id{993U}, handler_id{11}},
+    cina::map_entry{route_id{995U}, handler_id{12}},
+    cina::map_entry{route_id{3306U}, handler_id{13}},
+    cina::map_entry{route_id{5432U}, handler_id{14}},
+    cina::map_entry{route_id{6379U}, handler_id{15}},
+    cina::map_entry{route_id{8080U}, handler_id{16}}>;
+
+auto dynamic_routes() -> const std::unordered_map<route_id, handler_id>& {
+  static const std::unordered_map<route_id, handler_id> routes = [] {
+    std::unordered_map<route_id, handler_id> result;
+    for (std::size_t i = 0; i < static_routes::size(); ++i) {
+      result.emplace(static_routes::keys()[i], static_routes::values()[i]);
+    }
+    return result;
+  }();
+  return routes;
+}
+
+auto requests() -> const std::vector<route_id>& {
+  static const std::vector<route_id> keys = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::size_t> known{0,
+                                                     static_routes::size() - 1};
+    std::uniform_int_distribution<std::uint32_t> unknown{10'000, 20'000};
+    std::vector<route_id> result;
+    result.reserve(lookup_count);
+    for (std::size_t i = 0; i < lookup_count; ++i) {
+      result.push_back(i % 8 == 7 ? route_id{unknown(engine)}
+                                  : static_routes::keys()[known(engine)]);
+    }
+    return result;
+  }();
+  return keys;
+}
+
+auto unordered_map_lookup() -> void {
+  const auto& routes = dynamic_routes();
+  std::int64_t sum = 0;
+  for (const route_id& key : requests()) {
+    const auto it = routes.find(key);
+    sum += it == routes.end() ? 0 : it->second.unwrap();
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto static_map_lookup() -> void {
+  std::int64_t sum = 0;
+  for (const route_id& key : requests()) {
+    sum += static_routes::value_or(key, handler_id{0}).unwrap();
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("static_map/lookup", unordered_map_lookup,
+                   static_map_lookup, "unordered_map", "static_map");
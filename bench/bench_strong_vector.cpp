@@ -0,0 +1,57 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Compares indexing a std::vector with raw integers against indexing a
+// strong_vector with its index_range. Both loops are expected to vectorize.
+
+namespace {
+
+using row = cina::new_type<struct BenchRowTag, std::int32_t>;
+
+constexpr std::size_t element_count = 1 << 14;
+
+// All buffers are allocated together so that the relative placement of x and
+// y, which affects store-to-load aliasing, is the same for both workloads.
+struct buffers {
+  std::vector<float> raw_x = std::vector<float>(element_count, 1.0F);
+  std::vector<float> raw_y = std::vector<float>(element_count, 2.0F);
+  cina::strong_vector<row, float> strong_x =
+      cina::strong_vector<row, float>(element_count, 1.0F);
+  cina::strong_vector<row, float> strong_y =
+      cina::strong_vector<row, float>(element_count, 2.0F);
+};
+
+auto data() -> buffers& {
+  static buffers instance;
+  return instance;
+}
+
+auto raw_axpy() -> void {
+  const std::vector<float>& x = data().raw_x;
+  std::vector<float>& y = data().raw_y;
+  const auto size = static_cast<std::int32_t>(x.size());
+  for (std::int32_t i = 0; i < size; ++i) {
+    y[static_cast<std::size_t>(i)] += 3.0F * x[static_cast<std::size_t>(i)];
+  }
+  cina_bench::do_not_optimize(y.data());
+  cina_bench::clobber_memory();
+}
+
+auto strong_axpy() -> void {
+  const cina::strong_vector<row, float>& x = data().strong_x;
+  cina::strong_vector<row, float>& y = data().strong_y;
+  for (const row i : x.indices()) {
+    y[i] += 3.0F * x[i];
+  }
+  cina_bench::do_not_optimize(y.data());
+  cina_bench::clobber_memory();
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("strong_vector/axpy", raw_axpy, strong_axpy);
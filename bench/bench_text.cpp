@@ -0,0 +1,104 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// Compares the stream skills against the charconv skill on the same strong
+// type. Each call parses or prints text_size integers; the bulk-ingest
+// figure for larger inputs scales linearly with the per-call time.
+
+namespace {
+
+using strong_integer = cina::new_type<struct BenchTextTag, std::int32_t>;
+
+constexpr std::size_t text_size = 1 << 18;
+
+auto text() -> const std::string& {
+  static const std::string data = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::int32_t> distribution{-1'000'000,
+                                                             1'000'000};
+    std::string result;
+    for (std::size_t i = 0; i < text_size; ++i) {
+      result += std::to_string(distribution(engine));
+      result += ' ';
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto parse_stream() -> void {
+  std::istringstream is{text()};
+  strong_integer value{0};
+  std::int64_t sum = 0;
+  while (is >> value) {
+    sum += value.unwrap();
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto parse_charconv() -> void {
+  const std::string& in = text();
+  const char* first = in.data();
+  const char* const last = in.data() + in.size();
+  strong_integer value{0};
+  std::int64_t sum = 0;
+  while (first != last) {
+    const auto [ptr, ec] = from_chars(first, last, value);
+    if (ec != std::errc{}) {
+      break;
+    }
+    sum += value.unwrap();
+    first = ptr + 1;
+  }
+  cina_bench::do_not_optimize(sum);
+}
+
+auto values() -> const std::vector<strong_integer>& {
+  static const std::vector<strong_integer> data = [] {
+    std::vector<strong_integer> result;
+    result.reserve(text_size);
+    std::istringstream is{text()};
+    strong_integer value{0};
+    while (is >> value) {
+      result.push_back(value);
+    }
+    return result;
+  }();
+  return data;
+}
+
+auto print_stream() -> void {
+  std::ostringstream os;
+  for (const strong_integer& value : values()) {
+    os << value << ' ';
+  }
+  cina_bench::do_not_optimize(os.str().size());
+}
+
+auto print_charconv() -> void {
+  static std::string out(text().size(), '\0');
+  char* first = out.data();
+  char* const last = out.data() + out.size();
+  for (const strong_integer& value : values()) {
+    first = to_chars(first, last, value).ptr;
+    *first++ = ' ';
+  }
+  cina_bench::do_not_optimize(first);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("text/parse", parse_stream, parse_charconv, "stream",
+                   "charconv");
+CINA_BENCH_COMPARE("text/print", print_stream, print_charconv, "stream",
+                   "charconv");
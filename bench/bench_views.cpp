@@ -0,0 +1,72 @@
+#include "bench.hpp"
+
+#include <cina.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+// Compares passing a sequence of strong values to a routine that takes a span
+// of the underlying type by first copying it into a raw vector with passing it
+// through as_underlying_span or iterating views::unwrap.
+
+namespace {
+
+using sample = cina::new_type<struct BenchSampleTag, std::int32_t>;
+
+constexpr std::size_t sample_count = 1 << 16;
+
+auto samples() -> const std::vector<sample>& {
+  static const std::vector<sample> values = [] {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<std::int32_t> distribution{-1000, 1000};
+    std::vector<sample> result;
+    result.reserve(sample_count);
+    for (std::size_t i = 0; i < sample_count; ++i) {
+      result.push_back(sample{distribution(engine)});
+    }
+    return result;
+  }();
+  return values;
+}
+
+// A numeric routine in a library that knows nothing about strong types.
+[[gnu::noinline]] auto energy(const std::span<const std::int32_t> values)
+    -> std::int64_t {
+  std::int64_t total = 0;
+  for (const std::int32_t value : values) {
+    total += std::int64_t{value} * value;
+  }
+  return total;
+}
+
+auto copy_then_call() -> void {
+  const auto& in = samples();
+  std::vector<std::int32_t> raw;
+  raw.reserve(in.size());
+  for (const sample& value : in) {
+    raw.push_back(value.unwrap());
+  }
+  cina_bench::do_not_optimize(energy(raw));
+}
+
+auto span_call() -> void {
+  cina_bench::do_not_optimize(energy(cina::as_underlying_span(samples())));
+}
+
+auto unwrap_view() -> void {
+  std::int64_t total = 0;
+  for (const std::int32_t value : samples() | cina::views::unwrap) {
+    total += std::int64_t{value} * value;
+  }
+  cina_bench::do_not_optimize(total);
+}
+
+} // namespace
+
+CINA_BENCH_COMPARE("views/as_underlying_span", copy_then_call, span_call,
+                   "copy", "span");
+CINA_BENCH_COMPARE("views/unwrap", copy_then_call, unwrap_view, "copy",
+                   "view");
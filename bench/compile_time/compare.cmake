@@ -0,0 +1,46 @@
+# Times clean builds of the header and module compile-time benchmarks.
+#
+# Usage: cmake -DBUILD_DIR=<build dir> [-DCONFIG=<config>]
+#              -P bench/compile_time/compare.cmake
+#
+# The module benchmark is only available when the build directory was
+# configured with BUILD_MODULE=ON and CMake 3.28 or newer.
+
+cmake_minimum_required(VERSION 3.25)
+
+if(NOT DEFINED BUILD_DIR)
+    message(FATAL_ERROR "BUILD_DIR must be defined")
+endif()
+
+set(config_args)
+if(DEFINED CONFIG)
+    set(config_args --config ${CONFIG})
+endif()
+
+foreach(mode header module)
+    set(target cina_compile_bench_${mode})
+
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target clean
+            ${config_args}
+        OUTPUT_QUIET
+    )
+
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target ${target}
+            ${config_args}
+        RESULT_VARIABLE result
+        OUTPUT_QUIET
+        ERROR_QUIET
+    )
+    string(TIMESTAMP stop "%s%f" UTC)
+
+    if(NOT result EQUAL 0)
+        message(STATUS "${target}: not available in ${BUILD_DIR}")
+        continue()
+    endif()
+
+    math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+    message(STATUS "${target}: ${elapsed_ms} ms")
+endforeach()
\ No newline at end of file
@@ -1,2 +1,46 @@
+/// \file cina.cppm
+/// \author Alex Schiffer
+/// \brief Module interface for the cina library.
+///
+/// Exports everything declared in cina.hpp. The standard library headers are
+/// included in the global module fragment so that importers do not re-parse
+/// them.
+
 module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <expected>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 export module cina;
+
+#include "cina.hpp"
\ No newline at end of file
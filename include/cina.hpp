@@ -5,27 +5,80 @@
 #ifndef CINA_HPP
 #define CINA_HPP
 
+// When building the module interface, the standard headers are included in
+// the global module fragment of cina.cppm instead.
+#ifndef BUILD_MODULE
+#include <algorithm>        // stable_sort
+#include <array>            // array
+#include <atomic>           // atomic, atomic_ref, memory_order
+#include <bit>              // bit_cast, byteswap, endian
+#include <cassert>          // assert
+#include <charconv>         // from_chars, to_chars
+#include <compare>          // strong_ordering
 #include <concepts>         // same_as
+#include <cstddef>          // byte, size_t
+#include <cstdint>          // int8_t, int16_t, int32_t, int64_t, intmax_t
+#include <cstdlib>          // abort
+#include <cstring>          // memcpy
+#include <expected>         // expected, unexpected
 #include <format>           // formatter
 #include <functional>       // hash
 #include <initializer_list> // initializer_list
 #include <istream>          // basic_istream
-#include <iterator>         // back_inserter
+#include <iterator>         // input_iterator, iterator tags
+#include <limits>           // numeric_limits
+#include <memory>           // allocator
+#include <numeric>          // gcd
+#include <optional>         // optional
 #include <ostream>          // basic_ostream
-#include <string>           // string
+#include <ranges>           // views::transform
+#include <ratio>            // ratio, ratio_divide, ratio_multiply
+#include <span>             // span
+#include <stdexcept>        // out_of_range
 #include <string_view>      // string_view
+#include <tuple>            // apply, get, tuple
 #include <type_traits> // is_same, is_constructible, is_reference, is_assignable, remove_cvref, void_t
-#include <utility> // declval, forward
+#include <utility> // cmp_less, cmp_greater, declval, forward
+#include <vector>  // vector
+#endif
 
-#ifdef _MSVC_VER
+#ifdef _MSC_VER
 #define CINA_EBCO __declspec(empty_bases)
 #else
 #define CINA_EBCO
 #endif
 
+// Marks the operators, constructors and accessors that only forward to the
+// underlying value. They are inlined even without optimization, so that debug
+// builds are not slowed down by a chain of calls for every operator, and the
+// debugger steps over them. Define CINA_INLINE as empty to step into them.
+#ifndef CINA_INLINE
+#if defined(__clang__)
+#define CINA_INLINE [[gnu::always_inline, gnu::nodebug]]
+#elif defined(__GNUC__)
+#define CINA_INLINE [[gnu::always_inline, gnu::artificial]]
+#elif defined(_MSC_VER)
+#define CINA_INLINE [[msvc::forceinline]]
+#else
+#define CINA_INLINE
+#endif
+#endif
+
+#ifdef BUILD_MODULE
+#define CINA_EXPORT export
+#else
+#define CINA_EXPORT
+#endif
+
+// std::hardware_destructive_interference_size depends on the tuning flags, so
+// it is not used to lay out types that may cross translation units.
+#ifndef CINA_CACHE_LINE_SIZE
+#define CINA_CACHE_LINE_SIZE 64
+#endif
+
 /// \namespace cina
 /// \brief The \c cina namespace contains all the entities of the library.
-namespace cina {
+CINA_EXPORT namespace cina {
 
 ///////////////////
 // --- C++ Concepts
@@ -54,6 +107,70 @@ concept cxx_mathematical_signed_integer =
     !std::same_as<std::remove_cvref_t<T>, char> &&
     !std::same_as<std::remove_cvref_t<T>, wchar_t>;
 
+/// \brief Concept indicating a type is an unsigned integer for use in
+/// arithmetic expressions.
+///
+/// Concept indicating that a type is an unsigned integer or reference to an
+/// unsigned integer type, potentially <i>cv</i>-qualified, for use in
+/// arithmetic expressions. Specifically excludes \c bool and character types.
+///
+/// \tparam T The type to test.
+template <typename T>
+concept cxx_mathematical_unsigned_integer =
+    std::unsigned_integral<std::remove_cvref_t<T>> &&
+    !std::same_as<std::remove_cvref_t<T>, bool> &&
+    !std::same_as<std::remove_cvref_t<T>, char> &&
+    !std::same_as<std::remove_cvref_t<T>, wchar_t> &&
+    !std::same_as<std::remove_cvref_t<T>, char8_t> &&
+    !std::same_as<std::remove_cvref_t<T>, char16_t> &&
+    !std::same_as<std::remove_cvref_t<T>, char32_t>;
+
+/// \cond
+namespace _detail {
+template <typename T>
+concept _cxx_integer =
+    std::integral<T> && !std::same_as<T, bool> && !std::same_as<T, char> &&
+    !std::same_as<T, wchar_t> && !std::same_as<T, char8_t> &&
+    !std::same_as<T, char16_t> && !std::same_as<T, char32_t>;
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 _int128_t;
+__extension__ typedef unsigned __int128 _uint128_t;
+
+// The largest number of decimal digits any value of the widest integer type
+// can hold.
+inline constexpr int _decimal_max_digits = 38;
+#else
+inline constexpr int _decimal_max_digits = 18;
+#endif
+
+// The signed integer type of twice the size of a signed integer type. Selected
+// by size rather than by type so that long and long long map to the same
+// wide type whichever of them is std::int64_t.
+template <std::size_t Size> struct _double_width {};
+template <> struct _double_width<1> {
+  using type = std::int16_t;
+};
+template <> struct _double_width<2> {
+  using type = std::int32_t;
+};
+template <> struct _double_width<4> {
+  using type = std::int64_t;
+};
+#ifdef __SIZEOF_INT128__
+template <> struct _double_width<8> {
+  using type = _int128_t;
+};
+#endif
+
+template <typename T>
+using _double_width_t = typename _double_width<sizeof(T)>::type;
+
+template <typename T>
+concept _has_double_width = requires { typename _double_width_t<T>; };
+} // namespace _detail
+/// \endcond
+
 template <typename From, typename To>
 concept cxx_non_narrowing_integer_conversion =
     std::integral<From> && std::integral<To> &&
@@ -74,6 +191,10 @@ concept cxx_non_narrowing_integer_conversion =
 /// specialized types are not suitable. For example, for boolean types, class
 /// template \c boolean_type should be preferred.
 ///
+/// If \c UnderlyingType is trivially copyable, so is the strong type. Strong
+/// types built from \c strong_type and skills are standard-layout and have the
+/// same size and alignment as a standard-layout \c UnderlyingType, so
+/// containers and algorithms can copy them with \c memcpy.
 ///
 /// \tparam Tag A unique type used to create a distinct strong type. It is
 /// \tparam UnderlyingType The underlying type that the strong type wraps. It
@@ -96,6 +217,150 @@ template <typename Tag, cxx_boolean UnderlyingType> class boolean_type;
 template <typename Tag, cxx_mathematical_signed_integer>
 class signed_integer_type;
 
+/// \brief Strongly-typed unsigned integer.
+///
+/// Class template \c unsigned_integer_type is the unsigned counterpart of \c
+/// signed_integer_type. Arithmetic on types narrower than \c int is performed
+/// in <tt>unsigned int</tt>, so results never change signedness and
+/// multiplication never overflows a signed type. In addition to the
+/// arithmetic skills it supports the bitwise and shift operators, which
+/// preserve the width of the operands.
+template <typename Tag, cxx_mathematical_unsigned_integer>
+class unsigned_integer_type;
+
+/// \brief Range-constrained integer.
+///
+/// Class template \c range_integer models an Ada integer type declared with a
+/// range constraint, e.g. <tt>type Percent is range 0 .. 100</tt>. Values are
+/// stored in the smallest integer type that can represent <tt>[Lo, Hi]</tt>.
+/// Constructing a value outside the range is a compile-time error in constant
+/// expressions and throws \c constraint_error otherwise.
+///
+/// \tparam Tag A unique type used to create a distinct range type.
+/// \tparam Lo The smallest value of the range.
+/// \tparam Hi The largest value of the range.
+template <typename Tag, std::intmax_t Lo, std::intmax_t Hi>
+  requires(Lo <= Hi)
+class range_integer;
+
+/// \brief Modular integer.
+///
+/// Class template \c modular_integer models an Ada modular type, e.g.
+/// <tt>type Slot is mod 1024</tt>. Values lie in <tt>[0, N)</tt> and all
+/// arithmetic wraps modulo \c N. Values are stored in the smallest unsigned
+/// integer type that can represent <tt>N - 1</tt>. Constructing a value
+/// outside the range throws \c constraint_error; use \c mod() to reduce an
+/// arbitrary integer.
+///
+/// \tparam Tag A unique type used to create a distinct modular type.
+/// \tparam N The modulus. It must be greater than zero.
+template <typename Tag, std::uintmax_t N>
+  requires(N > 0)
+class modular_integer;
+
+/// \brief Binary fixed-point number.
+///
+/// Class template \c fixed_point models an Ada ordinary fixed-point type whose
+/// small is a power of two, i.e. a Q-format number. A value \c x is stored as
+/// the integer <tt>x * 2^FractionalBits</tt> in \c Storage. Products and
+/// quotients are computed in an integer type of twice the width of
+/// \c Storage and rescaled with shifts, so \c Storage must have such a type.
+///
+/// \tparam Tag A unique type used to create a distinct fixed-point type.
+/// \tparam Storage The signed integer type holding the scaled value.
+/// \tparam FractionalBits The number of fractional bits.
+template <typename Tag, cxx_mathematical_signed_integer Storage,
+          int FractionalBits>
+  requires(FractionalBits >= 0 &&
+           FractionalBits <= std::numeric_limits<Storage>::digits) &&
+          _detail::_has_double_width<Storage>
+class fixed_point;
+
+/// \brief Scaled decimal number.
+///
+/// Class template \c decimal models an Ada decimal fixed-point type with
+/// <tt>delta 10.0 ** (-Scale) digits Digits</tt>. A value \c x is stored as
+/// the integer <tt>x * 10^Scale</tt> in a \c std::int64_t if \c Digits is at
+/// most 18 and in a 128-bit integer otherwise.
+///
+/// \tparam Tag A unique type used to create a distinct decimal type.
+/// \tparam Digits The number of significant decimal digits.
+/// \tparam Scale The number of decimal digits after the decimal point.
+template <typename Tag, int Digits, int Scale>
+  requires(Digits > 0 && Scale >= 0 && Scale <= Digits &&
+           Digits <= _detail::_decimal_max_digits)
+class decimal;
+
+/// \brief Enumeration type.
+///
+/// Class template \c enumeration models an Ada enumeration type. The names of
+/// the enumerators of \c Enum are extracted at compile time and provide Ada's
+/// \c 'Image and \c 'Value attributes as \c name() and \c from_string().
+/// Enumerators are ordered by value and numbered by \c pos() from zero, so a
+/// value can index a \c std::array of \c size elements.
+///
+/// \tparam Tag A unique type used to create a distinct enumeration type.
+/// \tparam Enum An enumeration type with a fixed underlying type whose
+/// enumerators lie in <tt>[-128, 255]</tt>.
+template <typename Tag, typename Enum>
+  requires std::is_enum_v<Enum>
+class enumeration;
+
+/// \brief Set of flags.
+///
+/// Class template \c flags models a set of the enumerators of \c Enum, like
+/// an Ada array of \c Boolean indexed by an enumeration type with
+/// <tt>pragma Pack</tt>. The enumerator at position \c i, as numbered by
+/// \c enumeration, is bit \c i of the smallest unsigned integer type with at
+/// least one bit per enumerator.
+///
+/// \tparam Tag A unique type used to create a distinct flags type.
+/// \tparam Enum An enumeration type as accepted by \c enumeration with at
+/// most 64 enumerators.
+template <typename Tag, typename Enum>
+  requires std::is_enum_v<Enum>
+class flags;
+
+/// \brief Exponents of the SI base dimensions.
+///
+/// For example, velocity is <tt>dimension<1, 0, -1></tt>.
+template <int Length, int Mass, int Time, int Current = 0, int Temperature = 0,
+          int Amount = 0, int Luminosity = 0>
+struct dimension {};
+
+/// \cond
+namespace _detail {
+template <typename T> constexpr bool _is_dimension_v = false;
+template <int... Exponents>
+constexpr bool _is_dimension_v<dimension<Exponents...>> = true;
+
+template <typename T> constexpr bool _is_ratio_v = false;
+template <std::intmax_t Num, std::intmax_t Den>
+constexpr bool _is_ratio_v<std::ratio<Num, Den>> = true;
+} // namespace _detail
+/// \endcond
+
+/// \brief Physical quantity.
+///
+/// Class template \c quantity models a value of \c Dimension measured in
+/// units of \c Ratio times the coherent SI unit, like an Ada derived type per
+/// unit. Products and quotients of quantities have the derived dimension, and
+/// conversions between units of the same dimension multiply by a factor
+/// computed at compile time. Sums, differences and comparisons of different
+/// units of the same dimension are computed in their common unit.
+///
+/// \tparam Dimension A specialization of \c dimension.
+/// \tparam Ratio A \c std::ratio in lowest terms, e.g. \c std::kilo for
+/// kilometres, so that every unit is a single type.
+/// \tparam Rep The arithmetic type holding the value.
+template <typename Dimension, typename Ratio = std::ratio<1>,
+          typename Rep = double>
+  requires(_detail::_is_dimension_v<Dimension> &&
+           _detail::_is_ratio_v<Ratio> &&
+           std::same_as<Ratio, typename Ratio::type> &&
+           std::is_arithmetic_v<Rep>)
+class quantity;
+
 ////////////////////////
 // --- Cina Concepts ---
 ////////////////////////
@@ -157,8 +422,67 @@ constexpr inline bool _is_signed_integer<
 template <typename T>
 concept signed_integer = _detail::_is_signed_integer<T>;
 
+/// \cond
+namespace _detail {
+template <typename Tag, cxx_mathematical_unsigned_integer UnderlyingType>
+constexpr auto
+    _as_unsigned_integer_type(unsigned_integer_type<Tag, UnderlyingType>)
+        -> unsigned_integer_type<Tag, UnderlyingType>;
+
+template <typename T, typename Enable = void>
+constexpr inline bool _is_unsigned_integer = false;
+
+template <typename T>
+constexpr inline bool _is_unsigned_integer<
+    T, std::void_t<decltype(_as_unsigned_integer_type(std::declval<T>()))>> =
+    true;
+} // namespace _detail
+/// \endcond
+
+template <typename T>
+concept unsigned_integer = _detail::_is_unsigned_integer<T>;
+
+/// \cond
+namespace _detail {
+template <typename Tag, std::intmax_t Lo, std::intmax_t Hi>
+constexpr auto _as_range_integer_type(range_integer<Tag, Lo, Hi>)
+    -> range_integer<Tag, Lo, Hi>;
+
+template <typename T, typename Enable = void>
+constexpr inline bool _is_range_integer = false;
+
+template <typename T>
+constexpr inline bool _is_range_integer<
+    T, std::void_t<decltype(_as_range_integer_type(std::declval<T>()))>> =
+    true;
+} // namespace _detail
+/// \endcond
+
+template <typename T>
+concept range_constrained_integer = _detail::_is_range_integer<T>;
+
+/// \cond
+namespace _detail {
+template <typename Tag, std::uintmax_t N>
+constexpr auto _as_modular_integer_type(modular_integer<Tag, N>)
+    -> modular_integer<Tag, N>;
+
+template <typename T, typename Enable = void>
+constexpr inline bool _is_modular_integer = false;
+
 template <typename T>
-concept integer = signed_integer<T>;
+constexpr inline bool _is_modular_integer<
+    T, std::void_t<decltype(_as_modular_integer_type(std::declval<T>()))>> =
+    true;
+} // namespace _detail
+/// \endcond
+
+template <typename T>
+concept modular_type = _detail::_is_modular_integer<T>;
+
+template <typename T>
+concept integer = signed_integer<T> || unsigned_integer<T> ||
+                  range_constrained_integer<T> || modular_type<T>;
 
 template <typename T>
 concept arithmetic = integer<T>;
@@ -173,12 +497,270 @@ template <strong_type_like T> struct remove_reference {
 template <strong_type_like T>
 using remove_reference_t = typename _detail::remove_reference<T>::type;
 
+/////////////////////////////
+// --- Overflow Policies ---
+/////////////////////////////
+
+/// \brief Errors reported by checked arithmetic.
+enum class arithmetic_error {
+  overflow,
+};
+
+/// \cond
+namespace _detail {
+template <typename T> struct _overflow_result {
+  T value;
+  bool overflow;
+  T saturated;
+};
+
+template <typename T>
+CINA_INLINE
+constexpr inline T _saturate_toward(const T lhs) noexcept {
+  if constexpr (std::is_signed_v<T>) {
+    // max ^ -1 is min. Selecting the bound arithmetically rather than with a
+    // conditional keeps chains of saturating operations vectorizable.
+    return static_cast<T>((lhs >> std::numeric_limits<T>::digits) ^
+                          std::numeric_limits<T>::max());
+  } else {
+    return std::numeric_limits<T>::max();
+  }
+}
+
+// The exact result of an operation on types narrower than int is computed in
+// a wider type and clamped to the range of T. Overflow occurred if clamping
+// changed the result.
+template <typename T, typename Wide>
+CINA_INLINE
+constexpr auto _clamped_result(const Wide wide) noexcept
+    -> _overflow_result<T> {
+  constexpr auto min = static_cast<Wide>(std::numeric_limits<T>::min());
+  constexpr auto max = static_cast<Wide>(std::numeric_limits<T>::max());
+  Wide clamped = wide > max ? max : wide;
+  if constexpr (std::is_signed_v<Wide>) {
+    clamped = clamped < min ? min : clamped;
+  }
+  return {static_cast<T>(wide), clamped != wide, static_cast<T>(clamped)};
+}
+
+// Overflow is detected without __builtin_add_overflow and friends, which keeps
+// loops over these operations vectorizable. Sums and differences wrap in the
+// unsigned type at every width; overflow is read from the sign bits of the
+// operands and the wrapped result, or from the carry for unsigned types. Only
+// _checked_multiply clamps an exact result computed in a wider type.
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_add(const T lhs, const T rhs) noexcept
+    -> _overflow_result<T> {
+  using unsigned_type = std::make_unsigned_t<T>;
+  const auto value = static_cast<T>(static_cast<unsigned_type>(lhs) +
+                                    static_cast<unsigned_type>(rhs));
+  if constexpr (std::is_signed_v<T>) {
+    return {value, ((lhs ^ value) & (rhs ^ value)) < 0,
+            _saturate_toward(lhs)};
+  } else {
+    return {value, value < lhs, std::numeric_limits<T>::max()};
+  }
+}
+
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_subtract(const T lhs, const T rhs) noexcept
+    -> _overflow_result<T> {
+  using unsigned_type = std::make_unsigned_t<T>;
+  const auto value = static_cast<T>(static_cast<unsigned_type>(lhs) -
+                                    static_cast<unsigned_type>(rhs));
+  if constexpr (std::is_signed_v<T>) {
+    return {value, ((lhs ^ rhs) & (lhs ^ value)) < 0, _saturate_toward(lhs)};
+  } else {
+    return {value, lhs < rhs, std::numeric_limits<T>::min()};
+  }
+}
+
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_multiply(const T lhs, const T rhs) noexcept
+    -> _overflow_result<T> {
+  // The exact product of two operands narrower than int fits in an int, or an
+  // unsigned int for unsigned operands.
+  if constexpr (sizeof(T) < sizeof(int)) {
+    using wide_type =
+        std::conditional_t<std::is_signed_v<T>, int, unsigned int>;
+    return _clamped_result<T>(static_cast<wide_type>(lhs) *
+                              static_cast<wide_type>(rhs));
+  } else {
+    T saturated = std::numeric_limits<T>::max();
+    if constexpr (std::is_signed_v<T>) {
+      if ((lhs < 0) != (rhs < 0)) {
+        saturated = std::numeric_limits<T>::min();
+      }
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    T value{};
+    const bool overflow = __builtin_mul_overflow(lhs, rhs, &value);
+    return {value, overflow, saturated};
+#else
+    using wide_type = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+    const auto value = static_cast<T>(static_cast<wide_type>(lhs) *
+                                      static_cast<wide_type>(rhs));
+    bool overflow = false;
+    if constexpr (std::is_signed_v<T>) {
+      if (lhs == -1) {
+        overflow = rhs == std::numeric_limits<T>::min();
+      } else if (lhs != 0) {
+        overflow = value / lhs != rhs;
+      }
+    } else {
+      overflow = lhs != 0 && value / lhs != rhs;
+    }
+    return {value, overflow, saturated};
+#endif
+  }
+}
+
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_negate(const T value) noexcept
+    -> _overflow_result<T> {
+  using unsigned_type = std::make_unsigned_t<T>;
+  const auto result =
+      static_cast<T>(unsigned_type{0} - static_cast<unsigned_type>(value));
+  if constexpr (std::is_signed_v<T>) {
+    return {result, value == std::numeric_limits<T>::min(),
+            std::numeric_limits<T>::max()};
+  } else {
+    return {result, value != 0, T{0}};
+  }
+}
+
+// The only quotient that is not representable is min / -1, which is the
+// negation of min. The remainder of min % -1 is zero, but computing it traps on
+// x86, so the divisor is replaced by 1, which has the same remainder.
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_divide(const T lhs, const T rhs) noexcept
+    -> _overflow_result<T> {
+  if constexpr (std::is_signed_v<T>) {
+    if (rhs == -1) {
+      return _checked_negate(lhs);
+    }
+  }
+  return {static_cast<T>(lhs / rhs), false, T{0}};
+}
+
+template <_cxx_integer T>
+CINA_INLINE
+constexpr auto _checked_modulo(const T lhs, const T rhs) noexcept
+    -> _overflow_result<T> {
+  if constexpr (std::is_signed_v<T>) {
+    return {static_cast<T>(lhs % (rhs == -1 ? T{1} : rhs)), false, T{0}};
+  } else {
+    return {static_cast<T>(lhs % rhs), false, T{0}};
+  }
+}
+
+[[noreturn]] inline auto _trap() noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_trap();
+#else
+  std::abort();
+#endif
+}
+} // namespace _detail
+/// \endcond
+
+// An overflow policy provides a static member function template
+//
+//   template <typename Result, typename T>
+//   static constexpr auto resolve(T value, bool overflow, T saturated);
+//
+// that turns the wrapped result of an operation into the value returned by the
+// operator. \c value is the result modulo 2^N, \c overflow indicates whether
+// the mathematical result was not representable and \c saturated is the bound
+// closest to the mathematical result.
+
+/// \brief Overflow policy: results wrap around modulo 2^N.
+struct wrap {
+  template <typename Result, typename T>
+  CINA_INLINE
+  static constexpr auto resolve(const T value, bool, T) noexcept -> Result {
+    return Result{value};
+  }
+};
+
+/// \brief Overflow policy: results are clamped to the representable range.
+struct saturate {
+  template <typename Result, typename T>
+  CINA_INLINE
+  static constexpr auto resolve(const T value, const bool overflow,
+                                const T saturated) noexcept -> Result {
+    return Result{overflow ? saturated : value};
+  }
+};
+
+/// \brief Overflow policy: overflow terminates the program with a trap
+/// instruction.
+///
+/// In constant expressions overflow is a compile-time error.
+struct trap {
+  template <typename Result, typename T>
+  CINA_INLINE
+  static constexpr auto resolve(const T value, const bool overflow, T) noexcept
+      -> Result {
+    if (overflow) [[unlikely]] {
+      _detail::_trap();
+    }
+    return Result{value};
+  }
+};
+
+/// \brief Overflow policy: operators return a \c std::expected holding either
+/// the result or \c arithmetic_error::overflow.
+///
+/// Compound assignment operators are not provided with this policy.
+struct checked_expected {
+  template <typename Result, typename T>
+  CINA_INLINE
+  static constexpr auto resolve(const T value, const bool overflow, T) noexcept
+      -> std::expected<Result, arithmetic_error> {
+    if (overflow) {
+      return std::unexpected{arithmetic_error::overflow};
+    }
+    return Result{value};
+  }
+};
+
+/// \cond
+namespace _detail {
+template <typename Derived>
+using _value_t = std::remove_cvref_t<underlying_type_t<Derived>>;
+
+template <typename Derived>
+using _policy_result_t =
+    typename Derived::template rebind<_value_t<Derived>>;
+
+template <typename Policy, typename Derived>
+CINA_INLINE
+constexpr auto _resolve(const _overflow_result<_value_t<Derived>> r) {
+  return Policy::template resolve<_policy_result_t<Derived>>(
+      r.value, r.overflow, r.saturated);
+}
+
+template <typename Policy, typename Derived>
+concept _policy_assignable = requires(
+    const _overflow_result<_value_t<Derived>> r) {
+  { _resolve<Policy, Derived>(r) } -> std::same_as<_policy_result_t<Derived>>;
+};
+} // namespace _detail
+/// \endcond
+
 //////////////////
 // --- Skills ----
 //////////////////
 
 struct equality_comparison {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator==(const Derived& lhs, const Derived& rhs)
         -> bool {
       return lhs.unwrap() == rhs.unwrap();
@@ -188,6 +770,7 @@ struct equality_comparison {
 
 struct three_way_comparison {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator<=>(const Derived& lhs, const Derived& rhs) {
       return lhs.unwrap() <=> rhs.unwrap();
     }
@@ -198,8 +781,29 @@ struct three_way_comparison {
 namespace _detail {
 template <typename T>
 constexpr inline bool _need_signed_cast =
-    signed_integer<T> && std::is_same_v<underlying_type_t<T>, signed char>;
+    integer<T> &&
+    (std::is_same_v<std::remove_cvref_t<underlying_type_t<T>>, signed char> ||
+     std::is_same_v<std::remove_cvref_t<underlying_type_t<T>>, unsigned char>);
+
+// Unsigned types narrower than int are promoted to int by the built-in
+// operators. The arithmetic skills convert them to unsigned int instead so
+// that results stay unsigned and products cannot overflow a signed type.
+template <typename T>
+constexpr inline bool _promotes_to_int =
+    cxx_mathematical_unsigned_integer<T> &&
+    std::is_same_v<decltype(+std::declval<T>()), int>;
+
+template <typename T>
+CINA_INLINE
+[[nodiscard]] constexpr auto _arithmetic_operand(const T& value) noexcept
+    -> decltype(auto) {
+  if constexpr (_promotes_to_int<T>) {
+    return static_cast<unsigned int>(value);
+  } else {
+    return (value);
+  }
 }
+} // namespace _detail
 /// \endcond
 
 struct output_stream {
@@ -228,103 +832,610 @@ struct input_stream {
   };
 };
 
+/// \brief Skill for locale-independent conversion to and from text.
+///
+/// Provides hidden-friend overloads of \c to_chars and \c from_chars that
+/// forward to the \c std::to_chars and \c std::from_chars overload for the
+/// underlying type, including the optional base or format arguments. Unlike
+/// the stream skills, character types such as \c signed char are converted
+/// as numbers.
+struct charconv {
+  template <typename Derived> struct skill {
+    template <typename... Args>
+    friend auto to_chars(char* const first, char* const last,
+                         const Derived& value, const Args... args)
+        -> std::to_chars_result
+      requires requires(char* p,
+                        std::remove_cvref_t<underlying_type_t<Derived>> v) {
+        std::to_chars(p, p, v, args...);
+      }
+    {
+      return std::to_chars(first, last, value.unwrap(), args...);
+    }
+
+    template <typename... Args>
+    friend auto from_chars(const char* const first, const char* const last,
+                           Derived& value, const Args... args)
+        -> std::from_chars_result
+      requires requires(const char* p,
+                        std::remove_cvref_t<underlying_type_t<Derived>>& v) {
+        std::from_chars(p, p, v, args...);
+      }
+    {
+      return std::from_chars(first, last, value.unwrap(), args...);
+    }
+  };
+};
+
+/// \brief The splitmix64 finalizer, a fast mixer with full avalanche.
+///
+/// Every input bit affects every output bit, so sequential or strided keys are
+/// spread evenly over the buckets of a hash table.
+struct splitmix64 {
+  [[nodiscard]] constexpr auto operator()(std::uint64_t x) const noexcept
+      -> std::uint64_t {
+    x += 0x9e3779b97f4a7c15U;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9U;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebU;
+    return x ^ (x >> 31);
+  }
+};
+
+/// \cond
+namespace _detail {
+template <typename T>
+concept _hashable_bits = (std::integral<T> || std::is_enum_v<T>) &&
+                         sizeof(T) <= sizeof(std::uint64_t);
+
+// Zero-extends the bits of an integer or enumeration to 64 bits.
+template <_hashable_bits T>
+constexpr auto _hash_bits(const T value) noexcept -> std::uint64_t {
+  using unsigned_type = std::make_unsigned_t<
+      typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>,
+                                  std::type_identity<T>>::type>;
+  return static_cast<std::uint64_t>(static_cast<unsigned_type>(value));
+}
+
+template <typename Mixer, _hashable_bits T>
+constexpr auto _mix(const T value) noexcept -> std::size_t {
+  return static_cast<std::size_t>(Mixer{}(_hash_bits(value)));
+}
+} // namespace _detail
+/// \endcond
+
+/// \brief Skill that makes \c std::hash mix the bits of integer keys.
+///
+/// The \c std::hash specialization for strong types normally forwards to
+/// \c std::hash of the underlying type, which is the identity function for
+/// integers in common standard libraries. Types with this skill are hashed
+/// with \c splitmix64 instead, or with \c Mixer when using \c with<Mixer>.
+/// \c Mixer must be a default-constructible function object mapping a
+/// \c std::uint64_t to a \c std::uint64_t.
+struct hashing {
+  template <typename Derived> struct skill {
+    /// \brief The mixer used by the \c std::hash specialization.
+    using hash_mixer = splitmix64;
+  };
+
+  template <typename Mixer> struct with {
+    template <typename Derived> struct skill {
+      using hash_mixer = Mixer;
+    };
+  };
+};
+
+/// \cond
+namespace _detail {
+template <typename T>
+concept _binary_value =
+    std::is_trivially_copyable_v<T> &&
+    (sizeof(T) == 1 ||
+     ((std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+      (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)));
+
+template <std::size_t Size> struct _uint_of_size;
+template <> struct _uint_of_size<2> {
+  using type = std::uint16_t;
+};
+template <> struct _uint_of_size<4> {
+  using type = std::uint32_t;
+};
+template <> struct _uint_of_size<8> {
+  using type = std::uint64_t;
+};
+
+template <_binary_value T>
+inline auto _store(const T value, std::byte* const out, const std::endian order)
+    -> void {
+  if constexpr (sizeof(T) == 1) {
+    std::memcpy(out, &value, 1);
+  } else {
+    using bits_type = typename _uint_of_size<sizeof(T)>::type;
+    auto bits = std::bit_cast<bits_type>(value);
+    if (order != std::endian::native) {
+      bits = std::byteswap(bits);
+    }
+    std::memcpy(out, &bits, sizeof(T));
+  }
+}
+
+template <_binary_value T>
+inline auto _load(const std::byte* const in, const std::endian order) -> T {
+  if constexpr (std::is_same_v<T, bool>) {
+    return *in != std::byte{0};
+  } else if constexpr (sizeof(T) == 1) {
+    T value;
+    std::memcpy(&value, in, 1);
+    return value;
+  } else {
+    using bits_type = typename _uint_of_size<sizeof(T)>::type;
+    bits_type bits;
+    std::memcpy(&bits, in, sizeof(T));
+    if (order != std::endian::native) {
+      bits = std::byteswap(bits);
+    }
+    return std::bit_cast<T>(bits);
+  }
+}
+} // namespace _detail
+/// \endcond
+
+/// \brief Skill for encoding values to and decoding values from byte buffers.
+///
+/// Values are stored as the object representation of the underlying type in
+/// the byte order \c order. Bytes are only swapped if \c order differs from
+/// the native byte order, so encoding a range in native order is a single
+/// \c memcpy. Each function returns the number of bytes written or consumed,
+/// or 0 if the buffer is too small, in which case nothing is written.
+struct binary_io {
+  template <typename Derived> struct skill {
+    friend auto encode(const Derived& value, const std::span<std::byte> out,
+                       const std::endian order) -> std::size_t {
+      using value_type = std::remove_cvref_t<underlying_type_t<Derived>>;
+      if (out.size() < sizeof(value_type)) {
+        return 0;
+      }
+      _detail::_store<value_type>(value.unwrap(), out.data(), order);
+      return sizeof(value_type);
+    }
+
+    friend auto decode(const std::span<const std::byte> in, Derived& value,
+                       const std::endian order) -> std::size_t {
+      using value_type = std::remove_cvref_t<underlying_type_t<Derived>>;
+      if (in.size() < sizeof(value_type)) {
+        return 0;
+      }
+      value.unwrap() = _detail::_load<value_type>(in.data(), order);
+      return sizeof(value_type);
+    }
+
+    friend auto encode(const std::span<const Derived> values,
+                       const std::span<std::byte> out, const std::endian order)
+        -> std::size_t {
+      using value_type = std::remove_cvref_t<underlying_type_t<Derived>>;
+      const std::size_t size = values.size() * sizeof(value_type);
+      if (out.size() < size) {
+        return 0;
+      }
+      if constexpr (sizeof(Derived) == sizeof(value_type) &&
+                    std::is_trivially_copyable_v<Derived>) {
+        if (order == std::endian::native || sizeof(value_type) == 1) {
+          if (size != 0) {
+            std::memcpy(out.data(), values.data(), size);
+          }
+          return size;
+        }
+      }
+      std::byte* it = out.data();
+      for (const Derived& value : values) {
+        _detail::_store<value_type>(value.unwrap(), it, order);
+        it += sizeof(value_type);
+      }
+      return size;
+    }
+
+    friend auto decode(const std::span<const std::byte> in,
+                       const std::span<Derived> values, const std::endian order)
+        -> std::size_t {
+      using value_type = std::remove_cvref_t<underlying_type_t<Derived>>;
+      const std::size_t size = values.size() * sizeof(value_type);
+      if (in.size() < size) {
+        return 0;
+      }
+      if constexpr (sizeof(Derived) == sizeof(value_type) &&
+                    std::is_trivially_copyable_v<Derived> &&
+                    !std::is_same_v<value_type, bool>) {
+        if (order == std::endian::native || sizeof(value_type) == 1) {
+          if (size != 0) {
+            std::memcpy(values.data(), in.data(), size);
+          }
+          return size;
+        }
+      }
+      const std::byte* it = in.data();
+      for (Derived& value : values) {
+        value.unwrap() = _detail::_load<value_type>(it, order);
+        it += sizeof(value_type);
+      }
+      return size;
+    }
+  };
+};
+
 struct addition {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator+(const Derived& lhs, const Derived& rhs) {
-      using return_underlying_type = decltype(lhs.unwrap() + rhs.unwrap());
+      using return_underlying_type =
+          decltype(_detail::_arithmetic_operand(lhs.unwrap()) +
+                   _detail::_arithmetic_operand(rhs.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          lhs.unwrap() + rhs.unwrap()};
+          _detail::_arithmetic_operand(lhs.unwrap()) +
+          _detail::_arithmetic_operand(rhs.unwrap())};
     }
 
+    CINA_INLINE
     friend constexpr auto operator+=(Derived& lhs, const Derived& rhs)
         -> Derived& {
       lhs.unwrap() += rhs.unwrap();
       return lhs;
     }
   };
+
+  /// \brief Variant of \c addition whose result has the same underlying type
+  /// as the operands and whose overflow is handled by \c Policy.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator+(const Derived& lhs, const Derived& rhs) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_add(lhs.unwrap(), rhs.unwrap()));
+      }
+
+      CINA_INLINE
+      friend constexpr auto operator+=(Derived& lhs, const Derived& rhs)
+          -> Derived&
+        requires _detail::_policy_assignable<Policy, Derived>
+      {
+        lhs.unwrap() = (lhs + rhs).unwrap();
+        return lhs;
+      }
+    };
+  };
 };
 
 struct subtraction {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator-(const Derived& lhs, const Derived& rhs) {
-      using return_underlying_type = decltype(lhs.unwrap() - rhs.unwrap());
+      using return_underlying_type =
+          decltype(_detail::_arithmetic_operand(lhs.unwrap()) -
+                   _detail::_arithmetic_operand(rhs.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          lhs.unwrap() - rhs.unwrap()};
+          _detail::_arithmetic_operand(lhs.unwrap()) -
+          _detail::_arithmetic_operand(rhs.unwrap())};
     }
 
+    CINA_INLINE
     friend constexpr auto operator-=(Derived& lhs, const Derived& rhs)
         -> Derived& {
       lhs.unwrap() -= rhs.unwrap();
       return lhs;
     }
   };
-};
+
+  /// \brief Variant of \c subtraction whose result has the same underlying type
+  /// as the operands and whose overflow is handled by \c Policy.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator-(const Derived& lhs, const Derived& rhs) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_subtract(lhs.unwrap(), rhs.unwrap()));
+      }
+
+      CINA_INLINE
+      friend constexpr auto operator-=(Derived& lhs, const Derived& rhs)
+          -> Derived&
+        requires _detail::_policy_assignable<Policy, Derived>
+      {
+        lhs.unwrap() = (lhs - rhs).unwrap();
+        return lhs;
+      }
+    };
+  };
+};
 
 struct multiplication {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator*(const Derived& lhs, const Derived& rhs) {
-      using return_underlying_type = decltype(lhs.unwrap() * rhs.unwrap());
+      using return_underlying_type =
+          decltype(_detail::_arithmetic_operand(lhs.unwrap()) *
+                   _detail::_arithmetic_operand(rhs.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          lhs.unwrap() * rhs.unwrap()};
+          _detail::_arithmetic_operand(lhs.unwrap()) *
+          _detail::_arithmetic_operand(rhs.unwrap())};
     }
 
+    CINA_INLINE
     friend constexpr auto operator*=(Derived& lhs, const Derived& rhs)
         -> Derived& {
-      lhs.unwrap() *= rhs.unwrap();
+      using value_type = _detail::_value_t<Derived>;
+      if constexpr (_detail::_promotes_to_int<value_type>) {
+        lhs.unwrap() = static_cast<value_type>(
+            _detail::_arithmetic_operand(lhs.unwrap()) *
+            _detail::_arithmetic_operand(rhs.unwrap()));
+      } else {
+        lhs.unwrap() *= rhs.unwrap();
+      }
       return lhs;
     }
   };
+
+  /// \brief Variant of \c multiplication whose result has the same underlying
+  /// type as the operands and whose overflow is handled by \c Policy.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator*(const Derived& lhs, const Derived& rhs) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_multiply(lhs.unwrap(), rhs.unwrap()));
+      }
+
+      CINA_INLINE
+      friend constexpr auto operator*=(Derived& lhs, const Derived& rhs)
+          -> Derived&
+        requires _detail::_policy_assignable<Policy, Derived>
+      {
+        lhs.unwrap() = (lhs * rhs).unwrap();
+        return lhs;
+      }
+    };
+  };
 };
 
 struct division {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator/(const Derived& lhs, const Derived& rhs) {
-      using return_underlying_type = decltype(lhs.unwrap() / rhs.unwrap());
+      using return_underlying_type =
+          decltype(_detail::_arithmetic_operand(lhs.unwrap()) /
+                   _detail::_arithmetic_operand(rhs.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          lhs.unwrap() / rhs.unwrap()};
+          _detail::_arithmetic_operand(lhs.unwrap()) /
+          _detail::_arithmetic_operand(rhs.unwrap())};
     }
 
+    CINA_INLINE
     friend constexpr auto operator/=(Derived& lhs, const Derived& rhs)
         -> Derived& {
       lhs.unwrap() /= rhs.unwrap();
       return lhs;
     }
   };
+
+  /// \brief Variant of \c division whose result has the same underlying type as
+  /// the operands and whose overflow is handled by \c Policy.
+  ///
+  /// The divisor must not be zero.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator/(const Derived& lhs, const Derived& rhs) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_divide(lhs.unwrap(), rhs.unwrap()));
+      }
+
+      CINA_INLINE
+      friend constexpr auto operator/=(Derived& lhs, const Derived& rhs)
+          -> Derived&
+        requires _detail::_policy_assignable<Policy, Derived>
+      {
+        lhs.unwrap() = (lhs / rhs).unwrap();
+        return lhs;
+      }
+    };
+  };
 };
 
 struct modulo {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator%(const Derived& lhs, const Derived& rhs) {
-      using return_underlying_type = decltype(lhs.unwrap() % rhs.unwrap());
+      using return_underlying_type =
+          decltype(_detail::_arithmetic_operand(lhs.unwrap()) %
+                   _detail::_arithmetic_operand(rhs.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          lhs.unwrap() % rhs.unwrap()};
+          _detail::_arithmetic_operand(lhs.unwrap()) %
+          _detail::_arithmetic_operand(rhs.unwrap())};
     }
 
+    CINA_INLINE
     friend constexpr auto operator%=(Derived& lhs, const Derived& rhs)
         -> Derived& {
       lhs.unwrap() %= rhs.unwrap();
       return lhs;
     }
   };
+
+  /// \brief Variant of \c modulo whose result has the same underlying type as
+  /// the operands and whose overflow is handled by \c Policy.
+  ///
+  /// The divisor must not be zero.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator%(const Derived& lhs, const Derived& rhs) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_modulo(lhs.unwrap(), rhs.unwrap()));
+      }
+
+      CINA_INLINE
+      friend constexpr auto operator%=(Derived& lhs, const Derived& rhs)
+          -> Derived&
+        requires _detail::_policy_assignable<Policy, Derived>
+      {
+        lhs.unwrap() = (lhs % rhs).unwrap();
+        return lhs;
+      }
+    };
+  };
 };
 
 struct negation {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator-(const Derived& value) {
-      using return_underlying_type = decltype(-value.unwrap());
+      using return_underlying_type =
+          decltype(-_detail::_arithmetic_operand(value.unwrap()));
       return typename Derived::template rebind<return_underlying_type>{
-          -value.unwrap()};
+          -_detail::_arithmetic_operand(value.unwrap())};
+    }
+  };
+
+  /// \brief Variant of \c negation whose result has the same underlying type
+  /// as the operand and whose overflow is handled by \c Policy.
+  template <typename Policy> struct with {
+    template <typename Derived> struct skill {
+      CINA_INLINE
+      friend constexpr auto operator-(const Derived& value) {
+        return _detail::_resolve<Policy, Derived>(
+            _detail::_checked_negate(value.unwrap()));
+      }
+    };
+  };
+};
+
+/// \brief Skill set for the arithmetic operators whose results have the same
+/// underlying type as the operands.
+///
+/// The plain arithmetic skills follow the built-in operators, so operands
+/// narrower than \c int are promoted and loops over 8- and 16-bit types are
+/// computed in 32-bit lanes. With \c preserve_width the operators <tt>+</tt>,
+/// <tt>-</tt>, <tt>*</tt>, <tt>/</tt>, <tt>%</tt> and unary <tt>-</tt> stay at
+/// the width of the operands and overflow is handled by \c Policy.
+///
+/// ```cpp
+/// using sample = cina::new_type<struct SampleTag, std::int16_t,
+///                               cina::preserve_width<cina::saturate>,
+///                               cina::three_way_comparison>;
+/// ```
+template <typename Policy> struct preserve_width {
+  template <typename Derived>
+  struct CINA_EBCO skill
+      : public addition::with<Policy>::template skill<Derived>,
+        public subtraction::with<Policy>::template skill<Derived>,
+        public multiplication::with<Policy>::template skill<Derived>,
+        public division::with<Policy>::template skill<Derived>,
+        public modulo::with<Policy>::template skill<Derived>,
+        public negation::with<Policy>::template skill<Derived> {};
+};
+
+/// \brief Skill for the bitwise operators <tt>&</tt>, <tt>|</tt>, <tt>^</tt> and
+/// <tt>~</tt>.
+///
+/// The result has the same type as the operands, even if the underlying type
+/// is narrower than \c int.
+struct bitwise {
+  template <typename Derived> struct skill {
+    CINA_INLINE
+    friend constexpr auto operator&(const Derived& lhs, const Derived& rhs)
+        -> Derived {
+      return Derived{
+          static_cast<_detail::_value_t<Derived>>(lhs.unwrap() & rhs.unwrap())};
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator|(const Derived& lhs, const Derived& rhs)
+        -> Derived {
+      return Derived{
+          static_cast<_detail::_value_t<Derived>>(lhs.unwrap() | rhs.unwrap())};
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator^(const Derived& lhs, const Derived& rhs)
+        -> Derived {
+      return Derived{
+          static_cast<_detail::_value_t<Derived>>(lhs.unwrap() ^ rhs.unwrap())};
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator~(const Derived& value) -> Derived {
+      return Derived{static_cast<_detail::_value_t<Derived>>(~value.unwrap())};
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator&=(Derived& lhs, const Derived& rhs)
+        -> Derived& {
+      lhs.unwrap() &= rhs.unwrap();
+      return lhs;
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator|=(Derived& lhs, const Derived& rhs)
+        -> Derived& {
+      lhs.unwrap() |= rhs.unwrap();
+      return lhs;
+    }
+
+    CINA_INLINE
+    friend constexpr auto operator^=(Derived& lhs, const Derived& rhs)
+        -> Derived& {
+      lhs.unwrap() ^= rhs.unwrap();
+      return lhs;
+    }
+  };
+};
+
+/// \brief Skill for the shift operators <tt>\<\<</tt> and <tt>\>\></tt>.
+///
+/// The shift count is a plain integer. The result has the same type as the
+/// shifted value, so bits shifted out of a narrow underlying type are
+/// discarded.
+struct shift {
+  template <typename Derived> struct skill {
+    template <std::integral Count>
+    CINA_INLINE
+    friend constexpr auto operator<<(const Derived& value, const Count count)
+        -> Derived {
+      return Derived{static_cast<_detail::_value_t<Derived>>(
+          _detail::_arithmetic_operand(value.unwrap()) << count)};
+    }
+
+    template <std::integral Count>
+    CINA_INLINE
+    friend constexpr auto operator>>(const Derived& value, const Count count)
+        -> Derived {
+      return Derived{static_cast<_detail::_value_t<Derived>>(
+          _detail::_arithmetic_operand(value.unwrap()) >> count)};
+    }
+
+    template <std::integral Count>
+    CINA_INLINE
+    friend constexpr auto operator<<=(Derived& value, const Count count)
+        -> Derived& {
+      return value = value << count;
+    }
+
+    template <std::integral Count>
+    CINA_INLINE
+    friend constexpr auto operator>>=(Derived& value, const Count count)
+        -> Derived& {
+      return value = value >> count;
     }
   };
 };
 
 struct increment {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator++(Derived& value) -> Derived& {
       ++value.unwrap();
       return value;
     }
 
+    CINA_INLINE
     friend constexpr auto operator++(Derived& value, int) -> Derived {
       Derived temp = value;
       ++value.unwrap();
@@ -335,11 +1446,13 @@ struct increment {
 
 struct decrement {
   template <typename Derived> struct skill {
+    CINA_INLINE
     friend constexpr auto operator--(Derived& value) -> Derived& {
       --value.unwrap();
       return value;
     }
 
+    CINA_INLINE
     friend constexpr auto operator--(Derived& value, int) -> Derived {
       Derived temp = value;
       --value.unwrap();
@@ -361,6 +1474,19 @@ struct uninitialized_t {
 /// unitialized.
 constexpr inline uninitialized_t uninitialized{};
 
+/////////////////////
+// --- Exceptions ---
+/////////////////////
+
+/// \brief Exception thrown when a value violates the constraint of a type.
+///
+/// Named after Ada's \c Constraint_Error. For example, it is thrown when a
+/// \c range_integer is constructed from a value outside of its range.
+class constraint_error : public std::out_of_range {
+public:
+  using std::out_of_range::out_of_range;
+};
+
 //////////////////////////////////////
 // --- Strong Type Implementation ---
 //////////////////////////////////////
@@ -378,6 +1504,7 @@ public:
   /// underlying type with the same tag.
   template <typename U> using rebind = strong_type<Tag, U>;
 
+  CINA_INLINE
   constexpr strong_type()
     requires std::is_default_constructible_v<UnderlyingType>
       : _m_do_not_use_this{} {}
@@ -386,36 +1513,50 @@ public:
     requires std::is_default_constructible_v<UnderlyingType>
   {}
 
+  // The constructors forward with static_cast rather than std::forward, which
+  // is an out-of-line call in unoptimized builds.
   template <class U>
     requires std::is_constructible_v<UnderlyingType, U> &&
              (!strong_type_like<std::remove_cvref_t<U>> &&
               !std::is_same_v<std::remove_cvref_t<U>, std::in_place_t>)
+  CINA_INLINE
   constexpr explicit strong_type(U&& value)
-      : _m_do_not_use_this(std::forward<U>(value)) {}
+      : _m_do_not_use_this(static_cast<U&&>(value)) {}
 
   template <typename... Args>
     requires std::is_constructible_v<UnderlyingType, Args...>
+  CINA_INLINE
   constexpr explicit strong_type(std::in_place_t, Args&&... args)
-      : _m_do_not_use_this(std::forward<Args>(args)...) {}
+      : _m_do_not_use_this(static_cast<Args&&>(args)...) {}
 
   template <typename U, typename... Args>
     requires std::is_constructible_v<UnderlyingType, std::initializer_list<U>&,
                                      Args...>
+  CINA_INLINE
   constexpr explicit strong_type(std::in_place_t, std::initializer_list<U> il,
                                  Args&&... args)
-      : _m_do_not_use_this(il, std::forward<Args>(args)...) {}
+      : _m_do_not_use_this(il, static_cast<Args&&>(args)...) {}
 
   template <typename U>
     requires std::is_constructible_v<UnderlyingType, const U&>
+  CINA_INLINE
   constexpr explicit(!std::is_convertible_v<const U&, UnderlyingType>)
       strong_type(const strong_type<Tag, U>& other)
       : _m_do_not_use_this(other.unwrap()) {}
 
   template <typename U>
     requires std::is_constructible_v<UnderlyingType, U>
+  CINA_INLINE
   constexpr explicit(!std::is_convertible_v<U, UnderlyingType>)
       strong_type(strong_type<Tag, U>&& other)
-      : _m_do_not_use_this(std::move(other.unwrap())) {}
+      : _m_do_not_use_this(static_cast<U&&>(other.unwrap())) {}
+
+  // The copy and move operations must stay defaulted so that the strong type
+  // is trivially copyable whenever the underlying type is.
+  constexpr strong_type(const strong_type&) = default;
+  constexpr strong_type(strong_type&&) = default;
+  constexpr auto operator=(const strong_type&) -> strong_type& = default;
+  constexpr auto operator=(strong_type&&) -> strong_type& = default;
 
   template <class U>
     requires std::is_assignable_v<UnderlyingType&, const U&>
@@ -438,10 +1579,11 @@ public:
   }
 
   template <typename Self>
+  CINA_INLINE
   [[nodiscard]] constexpr auto&& unwrap(this Self&& self) noexcept
     requires(!std::is_reference_v<UnderlyingType>)
   {
-    return std::forward<Self>(self)._m_do_not_use_this;
+    return static_cast<Self&&>(self)._m_do_not_use_this;
   }
 
   constexpr auto
@@ -453,7 +1595,8 @@ public:
     swap(_m_do_not_use_this, other._m_do_not_use_this);
   }
 
-  // Design goa: usable as NTTP
+  // Public so that strong types are structural and can be used as non-type
+  // template arguments, see static_map.
   UnderlyingType _m_do_not_use_this;
 
 private:
@@ -484,8 +1627,9 @@ public:
     requires(std::is_constructible_v<UnderlyingType&, U> &&
              std::is_lvalue_reference_v<U> &&
              !strong_type_like<std::remove_cvref_t<U>>)
+  CINA_INLINE
   constexpr strong_type(U&& value)
-      : _m_do_not_use_this(&std::forward<U>(value)) {}
+      : _m_do_not_use_this(&static_cast<U&&>(value)) {}
 
   constexpr strong_type(const strong_type& other) = default;
   constexpr strong_type(strong_type&& other) = default;
@@ -494,6 +1638,7 @@ public:
     requires std::is_constructible_v<
                  std::add_lvalue_reference_t<UnderlyingType>, U> &&
              std::is_lvalue_reference_v<U>
+  CINA_INLINE
   constexpr explicit strong_type(const strong_type<Tag, U>& other)
       : _m_do_not_use_this(&other.unwrap()) {}
 
@@ -521,6 +1666,7 @@ public:
     return *this;
   }
 
+  CINA_INLINE
   [[nodiscard]] constexpr auto unwrap() const volatile noexcept
       -> UnderlyingType& {
     return *_m_do_not_use_this;
@@ -556,7 +1702,8 @@ class CINA_EBCO boolean_type
     : public strong_type<Tag, UnderlyingType>,
       public equality_comparison::skill<boolean_type<Tag, UnderlyingType>>,
       public output_stream::skill<boolean_type<Tag, UnderlyingType>>,
-      public input_stream::skill<boolean_type<Tag, UnderlyingType>> {
+      public input_stream::skill<boolean_type<Tag, UnderlyingType>>,
+      public binary_io::skill<boolean_type<Tag, UnderlyingType>> {
 
   using base_type = strong_type<Tag, UnderlyingType>;
 
@@ -565,6 +1712,7 @@ public:
 
   explicit boolean_type(const uninitialized_t) : base_type(uninitialized) {}
 
+  CINA_INLINE
   constexpr explicit boolean_type(const UnderlyingType value)
     requires(!std::is_reference_v<UnderlyingType>)
       : base_type(value) {}
@@ -572,9 +1720,10 @@ public:
   template <typename U>
     requires std::is_constructible_v<UnderlyingType, U> &&
              std::is_lvalue_reference_v<U>
+             CINA_INLINE
              constexpr explicit boolean_type(U&& value)
                requires std::is_reference_v<UnderlyingType>
-      : base_type(std::forward<U>(value)) {}
+      : base_type(static_cast<U&&>(value)) {}
 
   template <typename U>
   constexpr auto operator=(const boolean_type<Tag, U> other) -> boolean_type&
@@ -608,6 +1757,8 @@ class CINA_EBCO signed_integer_type
           signed_integer_type<Tag, UnderlyingType>>,
       public output_stream::skill<signed_integer_type<Tag, UnderlyingType>>,
       public input_stream::skill<signed_integer_type<Tag, UnderlyingType>>,
+      public binary_io::skill<signed_integer_type<Tag, UnderlyingType>>,
+      public charconv::skill<signed_integer_type<Tag, UnderlyingType>>,
       public addition::skill<signed_integer_type<Tag, UnderlyingType>>,
       public subtraction::skill<signed_integer_type<Tag, UnderlyingType>>,
       public multiplication::skill<signed_integer_type<Tag, UnderlyingType>>,
@@ -626,6 +1777,7 @@ public:
 
   template <typename U>
     requires cxx_non_narrowing_integer_conversion<U, UnderlyingType>
+  CINA_INLINE
   constexpr explicit signed_integer_type(const U value)
     requires(!std::is_reference_v<UnderlyingType>)
       : base_type(static_cast<UnderlyingType>(value)) {}
@@ -633,9 +1785,10 @@ public:
   template <typename U>
     requires std::is_constructible_v<UnderlyingType, U> &&
              std::is_lvalue_reference_v<U>
+             CINA_INLINE
              constexpr explicit signed_integer_type(U&& value)
                requires std::is_reference_v<UnderlyingType>
-      : base_type(std::forward<U>(value)) {}
+      : base_type(static_cast<U&&>(value)) {}
 
   template <typename U>
     requires cxx_non_narrowing_integer_conversion<U, UnderlyingType>
@@ -659,88 +1812,3578 @@ public:
   }
 };
 
-////////////////////////
-// --- Type Factory ---
-////////////////////////
+////////////////////////////////
+// --- Unsigned Integer Type ---
+////////////////////////////////
 
-/// \brief Tag type to prevent selection of specialized types in \c new_type.
-struct no_skills;
+template <typename Tag, cxx_mathematical_unsigned_integer UnderlyingType>
+class CINA_EBCO unsigned_integer_type
+    : public strong_type<Tag, UnderlyingType>,
+      public equality_comparison::skill<
+          unsigned_integer_type<Tag, UnderlyingType>>,
+      public three_way_comparison::skill<
+          unsigned_integer_type<Tag, UnderlyingType>>,
+      public output_stream::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public input_stream::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public binary_io::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public charconv::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public addition::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public subtraction::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public multiplication::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public division::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public modulo::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public increment::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public decrement::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public bitwise::skill<unsigned_integer_type<Tag, UnderlyingType>>,
+      public shift::skill<unsigned_integer_type<Tag, UnderlyingType>> {
+  using base_type = strong_type<Tag, UnderlyingType>;
 
-/// \cond
-namespace _detail {
+public:
+  template <typename U> using rebind = unsigned_integer_type<Tag, U>;
 
-template <typename Tag, typename T, typename... Args> struct _new_type_impl {
-  struct impl : public strong_type<Tag, T>,
-                public Args::template skill<impl>... {
-    using strong_type<Tag, T>::strong_type;
-  };
+  explicit unsigned_integer_type(const uninitialized_t)
+      : base_type(uninitialized) {}
 
-  using type = impl;
-};
+  template <typename U>
+    requires cxx_non_narrowing_integer_conversion<U, UnderlyingType>
+  CINA_INLINE
+  constexpr explicit unsigned_integer_type(const U value)
+    requires(!std::is_reference_v<UnderlyingType>)
+      : base_type(static_cast<UnderlyingType>(value)) {}
 
-template <typename Tag, typename T> struct _new_type_impl<Tag, T, no_skills> {
-  using type = strong_type<Tag, T>;
-};
+  template <typename U>
+    requires std::is_constructible_v<UnderlyingType, U> &&
+             std::is_lvalue_reference_v<U>
+             CINA_INLINE
+             constexpr explicit unsigned_integer_type(U&& value)
+               requires std::is_reference_v<UnderlyingType>
+      : base_type(static_cast<U&&>(value)) {}
 
-template <typename Tag, cxx_boolean T> struct _new_type_impl<Tag, T> {
-  using type = boolean_type<Tag, T>;
-};
+  template <typename U>
+    requires cxx_non_narrowing_integer_conversion<U, UnderlyingType>
+  constexpr auto operator=(const unsigned_integer_type<Tag, U> other)
+      -> unsigned_integer_type&
+    requires(!std::is_reference_v<UnderlyingType>)
+  {
+    this->unwrap() = static_cast<UnderlyingType>(other.unwrap());
+    return *this;
+  }
 
-template <typename Tag, cxx_mathematical_signed_integer T>
-struct _new_type_impl<Tag, T> {
-  using type = signed_integer_type<Tag, T>;
+  template <typename U>
+    requires cxx_non_narrowing_integer_conversion<
+        std::remove_reference_t<U>, std::remove_reference_t<UnderlyingType>>
+  constexpr auto operator=(const unsigned_integer_type<Tag, U> other)
+      -> unsigned_integer_type&
+    requires std::is_reference_v<UnderlyingType>
+  {
+    *this->_m_do_not_use_this = other.unwrap();
+    return *this;
+  }
 };
+
+/////////////////////////////
+// --- Range Integer Type ---
+/////////////////////////////
+
+/// \cond
+namespace _detail {
+template <typename T, std::intmax_t Lo, std::intmax_t Hi>
+constexpr inline bool _range_fits =
+    std::cmp_greater_equal(Lo, std::numeric_limits<T>::min()) &&
+    std::cmp_less_equal(Hi, std::numeric_limits<T>::max());
+
+// Unsigned storage is only used for widths narrower than int so that
+// arithmetic on the stored values always promotes to a signed type.
+template <std::intmax_t Lo, std::intmax_t Hi>
+using _range_storage_t = std::conditional_t<
+    _range_fits<std::int8_t, Lo, Hi>, std::int8_t,
+    std::conditional_t<
+        _range_fits<std::uint8_t, Lo, Hi>, std::uint8_t,
+        std::conditional_t<
+            _range_fits<std::int16_t, Lo, Hi>, std::int16_t,
+            std::conditional_t<
+                _range_fits<std::uint16_t, Lo, Hi>, std::uint16_t,
+                std::conditional_t<_range_fits<std::int32_t, Lo, Hi>,
+                                   std::int32_t, std::intmax_t>>>>>;
+
+template <std::intmax_t Lo, std::intmax_t Hi, typename T,
+          _cxx_integer U>
+constexpr auto _range_check(const U value) -> T {
+  if (std::cmp_less(value, Lo) || std::cmp_greater(value, Hi)) {
+    throw constraint_error{"value is outside the range of the type"};
+  }
+  return static_cast<T>(value);
+}
 } // namespace _detail
 /// \endcond
 
-// clang-format off
-/// \brief Type factory for creating strong types with a specified set of
-/// skills.
-///
-/// The alias template \c new_type creates a strong typedef. The alias template
-/// selects the appropriate type in the library based on the provided template
-/// arguments. For example, if \c bool is passed as \c T, the resulting type is
-/// a specialization of \c boolean_type. If no specialized type is suitable, the
-/// resulting type is a specialization of \c strong_type with the specified
-/// skills. The user may prevent the selection of specialized types by passing
-/// \c no_skills as a skill or explicitly providing a list of skills.
-///
-/// Examples
-///
-/// ```cpp
-/// using strong_boolean = cina::new_type<struct Tag1, bool>; // strong_boolean is a specialization of boolean_type
-/// using strong_integer = cina::new_type<struct Tag2, int>; // strong_integer is a specialization of strong_type
-/// using no_skills = cina::new_type<struct Tag3, bool, cina::no_skills>; // no_skills is a specialization of strong_type with no skills
-/// using strong_type = cina::new_type<struct Tag4, my_type, cina::output_stream>; // strong_type is a specialization of strong_type that
-/// supports outputting to a stream
-/// ```
-///
-/// \tparam Tag A unique type used to create a distinct strong type.
-/// \tparam UnderlyingType The underlying type that the strong type wraps.
-/// \tparam Args A list of types to customize the generated type.
-// clang-format on
-template <typename Tag, typename UnderlyingType, typename... Args>
-using new_type = _detail::_new_type_impl<Tag, UnderlyingType, Args...>::type;
+template <typename Tag, std::intmax_t Lo, std::intmax_t Hi>
+  requires(Lo <= Hi)
+class CINA_EBCO range_integer
+    : public strong_type<Tag, _detail::_range_storage_t<Lo, Hi>>,
+      public equality_comparison::skill<range_integer<Tag, Lo, Hi>>,
+      public three_way_comparison::skill<range_integer<Tag, Lo, Hi>>,
+      public output_stream::skill<range_integer<Tag, Lo, Hi>> {
+  using base_type = strong_type<Tag, _detail::_range_storage_t<Lo, Hi>>;
 
-} // namespace cina
+public:
+  /// \brief The integer type used to store the value.
+  using storage_type = _detail::_range_storage_t<Lo, Hi>;
 
-//////////////////////////////////////////
-// --- Standard Libary Specializations ---
-//////////////////////////////////////////
+  /// \brief The unconstrained integer type arithmetic is performed in.
+  ///
+  /// Like in Ada, arithmetic operators return a value of the base type. The
+  /// result is checked against the range only when it is converted back.
+  using base_integer_type =
+      signed_integer_type<Tag, decltype(+std::declval<storage_type>())>;
 
-template <cina::strong_type_like T> struct std::hash<T> {
-  auto operator()(const T& value) const -> std::size_t {
-    return std::hash<cina::underlying_type_t<T>>{}(value.unwrap());
+  /// \brief Returns the smallest value of the type, i.e. Ada's \c 'First.
+  [[nodiscard]] static constexpr auto first() noexcept -> range_integer {
+    return range_integer{Lo};
+  }
+
+  /// \brief Returns the largest value of the type, i.e. Ada's \c 'Last.
+  [[nodiscard]] static constexpr auto last() noexcept -> range_integer {
+    return range_integer{Hi};
+  }
+
+  explicit range_integer(const uninitialized_t) : base_type(uninitialized) {}
+
+  template <_detail::_cxx_integer U>
+  constexpr explicit range_integer(const U value)
+      : base_type(_detail::_range_check<Lo, Hi, storage_type>(value)) {}
+
+  template <typename U>
+    requires _detail::_cxx_integer<std::remove_cvref_t<U>>
+  constexpr explicit range_integer(const signed_integer_type<Tag, U> value)
+      : base_type(_detail::_range_check<Lo, Hi, storage_type>(value.unwrap())) {
+  }
+
+  /// \brief Returns the value converted to the base type.
+  [[nodiscard]] constexpr auto base() const noexcept -> base_integer_type {
+    return base_integer_type{
+        static_cast<underlying_type_t<base_integer_type>>(this->unwrap())};
+  }
+
+private:
+  friend constexpr auto operator+(const range_integer& lhs,
+                                  const range_integer& rhs)
+      -> base_integer_type {
+    return lhs.base() + rhs.base();
+  }
+
+  friend constexpr auto operator-(const range_integer& lhs,
+                                  const range_integer& rhs)
+      -> base_integer_type {
+    return lhs.base() - rhs.base();
+  }
+
+  friend constexpr auto operator*(const range_integer& lhs,
+                                  const range_integer& rhs)
+      -> base_integer_type {
+    return lhs.base() * rhs.base();
+  }
+
+  friend constexpr auto operator/(const range_integer& lhs,
+                                  const range_integer& rhs)
+      -> base_integer_type {
+    return lhs.base() / rhs.base();
+  }
+
+  friend constexpr auto operator%(const range_integer& lhs,
+                                  const range_integer& rhs)
+      -> base_integer_type {
+    return lhs.base() % rhs.base();
+  }
+
+  friend constexpr auto operator-(const range_integer& value)
+      -> base_integer_type {
+    return -value.base();
+  }
+
+  friend constexpr auto operator+=(range_integer& lhs, const range_integer& rhs)
+      -> range_integer& {
+    return lhs = range_integer{lhs + rhs};
+  }
+
+  friend constexpr auto operator-=(range_integer& lhs, const range_integer& rhs)
+      -> range_integer& {
+    return lhs = range_integer{lhs - rhs};
+  }
+
+  friend constexpr auto operator*=(range_integer& lhs, const range_integer& rhs)
+      -> range_integer& {
+    return lhs = range_integer{lhs * rhs};
+  }
+
+  friend constexpr auto operator/=(range_integer& lhs, const range_integer& rhs)
+      -> range_integer& {
+    return lhs = range_integer{lhs / rhs};
+  }
+
+  friend constexpr auto operator%=(range_integer& lhs, const range_integer& rhs)
+      -> range_integer& {
+    return lhs = range_integer{lhs % rhs};
+  }
+
+  friend constexpr auto operator++(range_integer& value) -> range_integer& {
+    return value = range_integer{value.base() + base_integer_type{1}};
+  }
+
+  friend constexpr auto operator++(range_integer& value, int)
+      -> range_integer {
+    const range_integer temp = value;
+    ++value;
+    return temp;
+  }
+
+  friend constexpr auto operator--(range_integer& value) -> range_integer& {
+    return value = range_integer{value.base() - base_integer_type{1}};
+  }
+
+  friend constexpr auto operator--(range_integer& value, int)
+      -> range_integer {
+    const range_integer temp = value;
+    --value;
+    return temp;
+  }
+
+  // Values read from a stream are checked against the range. A value outside
+  // of the range sets failbit and leaves the target unchanged.
+  template <typename CharT, typename Traits>
+  friend auto operator>>(std::basic_istream<CharT, Traits>& is,
+                         range_integer& value)
+      -> std::basic_istream<CharT, Traits>& {
+    std::intmax_t raw{};
+    if (is >> raw) {
+      if (std::cmp_less(raw, Lo) || std::cmp_greater(raw, Hi)) {
+        is.setstate(std::ios_base::failbit);
+      } else {
+        value.unwrap() = static_cast<storage_type>(raw);
+      }
+    }
+    return is;
   }
 };
 
+///////////////////////////////
+// --- Modular Integer Type ---
+///////////////////////////////
+
+/// \cond
+namespace _detail {
+template <std::uintmax_t N>
+using _modular_storage_t = std::conditional_t<
+    (N - 1 <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+    std::conditional_t<
+        (N - 1 <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+        std::conditional_t<(N - 1 <= std::numeric_limits<std::uint32_t>::max()),
+                           std::uint32_t, std::uintmax_t>>>;
+
+// Arithmetic modulo N on values in [0, N). Sums and differences are corrected
+// with a single conditional add or subtract. Products are reduced with a mask
+// if N is a power of two and with a precomputed Barrett reduction otherwise:
+// a 64-bit factor if N fits in 32 bits and a 128-bit factor above that. Without
+// a 128-bit type, wide products fall back to shift-and-add multiplication, so
+// no path performs a hardware divide.
+template <std::uintmax_t N> struct _modular_arithmetic {
+  using value_type = _modular_storage_t<N>;
+
+  static constexpr bool power_of_two = (N & (N - 1)) == 0;
+  static constexpr value_type mask = static_cast<value_type>(N - 1);
+
+  static constexpr auto add(const value_type lhs, const value_type rhs) noexcept
+      -> value_type {
+    if constexpr (power_of_two) {
+      return static_cast<value_type>((std::uintmax_t{lhs} + rhs) & mask);
+    } else {
+      // Computed in uintmax_t; a sum that wraps is still corrected by the
+      // subtraction of N modulo 2^64.
+      const std::uintmax_t sum = std::uintmax_t{lhs} + rhs;
+      return static_cast<value_type>(sum >= N || sum < lhs ? sum - N : sum);
+    }
+  }
+
+  static constexpr auto subtract(const value_type lhs,
+                                 const value_type rhs) noexcept -> value_type {
+    if constexpr (power_of_two) {
+      return static_cast<value_type>((std::uintmax_t{lhs} - rhs) & mask);
+    } else {
+      const std::uintmax_t difference = std::uintmax_t{lhs} - rhs;
+      return static_cast<value_type>(lhs < rhs ? difference + N : difference);
+    }
+  }
+
+  static constexpr auto multiply(const value_type lhs,
+                                 const value_type rhs) noexcept -> value_type {
+    if constexpr (power_of_two) {
+      return static_cast<value_type>((std::uintmax_t{lhs} * rhs) & mask);
+    } else if constexpr (N <= std::numeric_limits<std::uint32_t>::max()) {
+      return static_cast<value_type>(
+          _barrett_reduce(std::uint64_t{lhs} * std::uint64_t{rhs}));
+    } else {
+#ifdef __SIZEOF_INT128__
+      return static_cast<value_type>(
+          _barrett_reduce_wide(_uint128_t{lhs} * rhs));
+#else
+      // Russian-peasant multiplication keeps every intermediate below 2N.
+      value_type result = 0;
+      value_type base = lhs;
+      for (value_type exponent = rhs; exponent != 0; exponent >>= 1) {
+        if (exponent & 1) {
+          result = add(result, base);
+        }
+        base = add(base, base);
+      }
+      return result;
+#endif
+    }
+  }
+
+  static constexpr auto negate(const value_type value) noexcept -> value_type {
+    return subtract(0, value);
+  }
+
+  // Reduces an arbitrary integer modulo N; negative values wrap like Ada's
+  // 'Mod attribute.
+  template <_cxx_integer U>
+  static constexpr auto reduce(const U value) noexcept -> value_type {
+    if constexpr (std::is_signed_v<U>) {
+      if (value < 0) {
+        // -(value + 1) is representable for every negative value.
+        const auto magnitude = static_cast<std::uintmax_t>(-(value + 1));
+        return static_cast<value_type>(N - 1 - magnitude % N);
+      }
+    }
+    return static_cast<value_type>(static_cast<std::uintmax_t>(value) % N);
+  }
+
+private:
+  // floor(2^64 / N) for N that is not a power of two. With p < 2^64 the
+  // estimated quotient is at most one too small, so a single correction step
+  // suffices.
+  static constexpr std::uint64_t barrett_factor =
+      N <= std::numeric_limits<std::uint32_t>::max() && !power_of_two
+          ? std::numeric_limits<std::uint64_t>::max() / N
+          : 0;
+
+  static constexpr auto _multiply_high(const std::uint64_t lhs,
+                                       const std::uint64_t rhs) noexcept
+      -> std::uint64_t {
+#ifdef __SIZEOF_INT128__
+    return static_cast<std::uint64_t>((_uint128_t{lhs} * rhs) >> 64);
+#else
+    const std::uint64_t lhs_lo = lhs & 0xffffffffU;
+    const std::uint64_t lhs_hi = lhs >> 32;
+    const std::uint64_t rhs_lo = rhs & 0xffffffffU;
+    const std::uint64_t rhs_hi = rhs >> 32;
+    const std::uint64_t lo_lo = lhs_lo * rhs_lo;
+    const std::uint64_t hi_lo = lhs_hi * rhs_lo;
+    const std::uint64_t lo_hi = lhs_lo * rhs_hi;
+    const std::uint64_t cross =
+        (lo_lo >> 32) + (hi_lo & 0xffffffffU) + lo_hi;
+    return lhs_hi * rhs_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+  }
+
+  static constexpr auto _barrett_reduce(const std::uint64_t value) noexcept
+      -> std::uint64_t {
+    const std::uint64_t quotient = _multiply_high(value, barrett_factor);
+    const std::uint64_t remainder = value - quotient * N;
+    return remainder >= N ? remainder - N : remainder;
+  }
+
+#ifdef __SIZEOF_INT128__
+  // floor((2^128 - 1) / N) for N above 32 bits that is not a power of two.
+  // The estimated quotient is at most two too small, so the remainder is
+  // below 3N and two correction steps suffice.
+  static constexpr _uint128_t wide_barrett_factor =
+      N > std::numeric_limits<std::uint32_t>::max() && !power_of_two
+          ? ~_uint128_t{0} / N
+          : 0;
+
+  // The high half of the 256-bit product, from four 64-bit multiplies.
+  static constexpr auto _multiply_high_wide(const _uint128_t lhs,
+                                            const _uint128_t rhs) noexcept
+      -> _uint128_t {
+    const _uint128_t lhs_lo = static_cast<std::uint64_t>(lhs);
+    const _uint128_t lhs_hi = lhs >> 64;
+    const _uint128_t rhs_lo = static_cast<std::uint64_t>(rhs);
+    const _uint128_t rhs_hi = rhs >> 64;
+    const _uint128_t lo_lo = lhs_lo * rhs_lo;
+    const _uint128_t hi_lo = lhs_hi * rhs_lo;
+    const _uint128_t lo_hi = lhs_lo * rhs_hi;
+    const _uint128_t cross = (lo_lo >> 64) + static_cast<std::uint64_t>(hi_lo) +
+                             static_cast<std::uint64_t>(lo_hi);
+    return lhs_hi * rhs_hi + (hi_lo >> 64) + (lo_hi >> 64) + (cross >> 64);
+  }
+
+  static constexpr auto _barrett_reduce_wide(const _uint128_t value) noexcept
+      -> std::uint64_t {
+    const _uint128_t quotient = _multiply_high_wide(value, wide_barrett_factor);
+    _uint128_t remainder = value - quotient * N;
+    if (remainder >= N) {
+      remainder -= N;
+    }
+    if (remainder >= N) {
+      remainder -= N;
+    }
+    return static_cast<std::uint64_t>(remainder);
+  }
+#endif
+};
+} // namespace _detail
+/// \endcond
+
+template <typename Tag, std::uintmax_t N>
+  requires(N > 0)
+class CINA_EBCO modular_integer
+    : public strong_type<Tag, _detail::_modular_storage_t<N>>,
+      public equality_comparison::skill<modular_integer<Tag, N>>,
+      public three_way_comparison::skill<modular_integer<Tag, N>>,
+      public output_stream::skill<modular_integer<Tag, N>> {
+  using base_type = strong_type<Tag, _detail::_modular_storage_t<N>>;
+  using arithmetic_type = _detail::_modular_arithmetic<N>;
+
+public:
+  /// \brief The unsigned integer type used to store the value.
+  using storage_type = _detail::_modular_storage_t<N>;
+
+  /// \brief The modulus of the type, i.e. Ada's \c 'Modulus.
+  static constexpr std::uintmax_t modulus = N;
+
+  /// \brief Returns the value of the type congruent to \c value, i.e. Ada's
+  /// \c 'Mod.
+  template <_detail::_cxx_integer U>
+  [[nodiscard]] static constexpr auto mod(const U value) noexcept
+      -> modular_integer {
+    return _make(arithmetic_type::reduce(value));
+  }
+
+  /// \brief Returns the smallest value of the type, i.e. Ada's \c 'First.
+  [[nodiscard]] static constexpr auto first() noexcept -> modular_integer {
+    return modular_integer{0};
+  }
+
+  /// \brief Returns the largest value of the type, i.e. Ada's \c 'Last.
+  [[nodiscard]] static constexpr auto last() noexcept -> modular_integer {
+    return modular_integer{N - 1};
+  }
+
+  explicit modular_integer(const uninitialized_t) : base_type(uninitialized) {}
+
+  template <_detail::_cxx_integer U>
+  constexpr explicit modular_integer(const U value)
+      : base_type(_check(value)) {}
+
+private:
+  constexpr modular_integer(std::in_place_t, const storage_type value) noexcept
+      : base_type(std::in_place, value) {}
+
+  template <_detail::_cxx_integer U>
+  static constexpr auto _check(const U value) -> storage_type {
+    if (std::cmp_less(value, 0) || std::cmp_greater_equal(value, N)) {
+      throw constraint_error{"value is outside the range of the type"};
+    }
+    return static_cast<storage_type>(value);
+  }
+
+  static constexpr auto _make(const storage_type value) noexcept
+      -> modular_integer {
+    return modular_integer{std::in_place, value};
+  }
+
+  friend constexpr auto operator+(const modular_integer& lhs,
+                                  const modular_integer& rhs) noexcept
+      -> modular_integer {
+    return _make(arithmetic_type::add(lhs.unwrap(), rhs.unwrap()));
+  }
+
+  friend constexpr auto operator-(const modular_integer& lhs,
+                                  const modular_integer& rhs) noexcept
+      -> modular_integer {
+    return _make(arithmetic_type::subtract(lhs.unwrap(), rhs.unwrap()));
+  }
+
+  friend constexpr auto operator*(const modular_integer& lhs,
+                                  const modular_integer& rhs) noexcept
+      -> modular_integer {
+    return _make(arithmetic_type::multiply(lhs.unwrap(), rhs.unwrap()));
+  }
+
+  friend constexpr auto operator/(const modular_integer& lhs,
+                                  const modular_integer& rhs)
+      -> modular_integer {
+    return _make(static_cast<storage_type>(lhs.unwrap() / rhs.unwrap()));
+  }
+
+  friend constexpr auto operator%(const modular_integer& lhs,
+                                  const modular_integer& rhs)
+      -> modular_integer {
+    return _make(static_cast<storage_type>(lhs.unwrap() % rhs.unwrap()));
+  }
+
+  friend constexpr auto operator-(const modular_integer& value) noexcept
+      -> modular_integer {
+    return _make(arithmetic_type::negate(value.unwrap()));
+  }
+
+  friend constexpr auto operator+=(modular_integer& lhs,
+                                   const modular_integer& rhs) noexcept
+      -> modular_integer& {
+    return lhs = lhs + rhs;
+  }
+
+  friend constexpr auto operator-=(modular_integer& lhs,
+                                   const modular_integer& rhs) noexcept
+      -> modular_integer& {
+    return lhs = lhs - rhs;
+  }
+
+  friend constexpr auto operator*=(modular_integer& lhs,
+                                   const modular_integer& rhs) noexcept
+      -> modular_integer& {
+    return lhs = lhs * rhs;
+  }
+
+  friend constexpr auto operator/=(modular_integer& lhs,
+                                   const modular_integer& rhs)
+      -> modular_integer& {
+    return lhs = lhs / rhs;
+  }
+
+  friend constexpr auto operator%=(modular_integer& lhs,
+                                   const modular_integer& rhs)
+      -> modular_integer& {
+    return lhs = lhs % rhs;
+  }
+
+  friend constexpr auto operator++(modular_integer& value) noexcept
+      -> modular_integer& {
+    return value = _make(arithmetic_type::add(value.unwrap(), 1));
+  }
+
+  friend constexpr auto operator++(modular_integer& value, int) noexcept
+      -> modular_integer {
+    const modular_integer temp = value;
+    ++value;
+    return temp;
+  }
+
+  friend constexpr auto operator--(modular_integer& value) noexcept
+      -> modular_integer& {
+    return value = _make(arithmetic_type::subtract(value.unwrap(), 1));
+  }
+
+  friend constexpr auto operator--(modular_integer& value, int) noexcept
+      -> modular_integer {
+    const modular_integer temp = value;
+    --value;
+    return temp;
+  }
+
+  // Values read from a stream are checked against the range. A value outside
+  // of the range sets failbit and leaves the target unchanged.
+  template <typename CharT, typename Traits>
+  friend auto operator>>(std::basic_istream<CharT, Traits>& is,
+                         modular_integer& value)
+      -> std::basic_istream<CharT, Traits>& {
+    std::uintmax_t raw{};
+    if (is >> raw) {
+      if (raw >= N) {
+        is.setstate(std::ios_base::failbit);
+      } else {
+        value.unwrap() = static_cast<storage_type>(raw);
+      }
+    }
+    return is;
+  }
+};
+
+///////////////////////////
+// --- Fixed Point Type ---
+///////////////////////////
+
+/// \cond
+namespace _detail {
+// Converts the raw value of a fixed-point number with From fractional bits to
+// To fractional bits. The shift direction is known at compile time.
+template <int From, int To, typename T>
+constexpr auto _rescale(const T raw) noexcept -> T {
+  if constexpr (To >= From) {
+    return static_cast<T>(raw * (T{1} << (To - From)));
+  } else {
+    return static_cast<T>(raw >> (From - To));
+  }
+}
+} // namespace _detail
+/// \endcond
+
+template <typename Tag, cxx_mathematical_signed_integer Storage,
+          int FractionalBits>
+  requires(FractionalBits >= 0 &&
+           FractionalBits <= std::numeric_limits<Storage>::digits) &&
+          _detail::_has_double_width<Storage>
+class CINA_EBCO fixed_point
+    : public strong_type<Tag, Storage>,
+      public equality_comparison::skill<
+          fixed_point<Tag, Storage, FractionalBits>>,
+      public three_way_comparison::skill<
+          fixed_point<Tag, Storage, FractionalBits>> {
+  using base_type = strong_type<Tag, Storage>;
+  using wide_type = _detail::_double_width_t<Storage>;
+
+  static constexpr wide_type one = wide_type{1} << FractionalBits;
+
+  template <typename OtherStorage>
+  using _rescale_type = std::common_type_t<wide_type, OtherStorage>;
+
+public:
+  /// \brief The signed integer type holding the scaled value.
+  using storage_type = Storage;
+
+  /// \brief The strongly-typed integer holding the scaled value.
+  using base_integer_type = signed_integer_type<Tag, Storage>;
+
+  /// \brief The number of fractional bits.
+  static constexpr int fractional_bits = FractionalBits;
+
+  /// \brief The difference between consecutive values, i.e. Ada's \c 'Small.
+  static constexpr double delta = 1.0 / static_cast<double>(one);
+
+  /// \brief Constructs a value from its scaled integer representation.
+  [[nodiscard]] static constexpr auto from_raw(const Storage raw) noexcept
+      -> fixed_point {
+    return fixed_point{std::in_place, raw};
+  }
+
+  explicit fixed_point(const uninitialized_t) : base_type(uninitialized) {}
+
+  /// \brief Constructs the value nearest to \c value.
+  ///
+  /// In a constant expression the conversion is folded into the scaled
+  /// constant, so no floating-point operation remains at run time.
+  ///
+  /// \throws constraint_error if \c value is NaN or its nearest value is
+  /// outside the range of the type.
+  template <std::floating_point F>
+  constexpr explicit fixed_point(const F value)
+      : base_type(std::in_place, _scale(value)) {}
+
+  /// \brief Constructs the value equal to the integer \c value.
+  template <cxx_mathematical_signed_integer I>
+  constexpr explicit fixed_point(const I value) noexcept
+      : base_type(std::in_place, static_cast<Storage>(value * one)) {}
+
+  /// \brief Converts from a fixed-point type with a different format.
+  ///
+  /// Fractional bits are added with a shift left or dropped with an
+  /// arithmetic shift right, which rounds toward negative infinity.
+  template <typename OtherStorage, int OtherBits>
+  constexpr explicit fixed_point(
+      const fixed_point<Tag, OtherStorage, OtherBits> other) noexcept
+      : base_type(std::in_place,
+                  static_cast<Storage>(
+                      _detail::_rescale<OtherBits, FractionalBits>(
+                          static_cast<_rescale_type<OtherStorage>>(
+                              other.unwrap())))) {}
+
+  /// \brief Returns the scaled integer representation.
+  [[nodiscard]] constexpr auto raw() const noexcept -> Storage {
+    return this->unwrap();
+  }
+
+  /// \brief Returns the scaled integer representation as the base type.
+  [[nodiscard]] constexpr auto base() const noexcept -> base_integer_type {
+    return base_integer_type{this->unwrap()};
+  }
+
+  template <std::floating_point F>
+  [[nodiscard]] constexpr explicit operator F() const noexcept {
+    return static_cast<F>(this->unwrap()) / static_cast<F>(one);
+  }
+
+private:
+  constexpr fixed_point(std::in_place_t, const Storage raw) noexcept
+      : base_type(std::in_place, raw) {}
+
+  template <std::floating_point F>
+  static constexpr auto _scale(const F value) -> Storage {
+    const F scaled =
+        value * static_cast<F>(one) + (value < 0 ? F{-0.5} : F{0.5});
+    // The conversion truncates, so scaled must lie in (min - 1, max + 1).
+    // max + 1 is a power of two and exact; min - 1 may round to min, in which
+    // case no value lies strictly between them. NaN fails every comparison.
+    constexpr F lo = static_cast<F>(std::numeric_limits<Storage>::min());
+    constexpr F hi = -lo;
+    if (!((scaled >= lo || scaled > lo - F{1}) && scaled < hi)) {
+      throw constraint_error{"value is outside the range of the type"};
+    }
+    return static_cast<Storage>(scaled);
+  }
+
+  // Sums and differences are computed in the double-width type and wrap on
+  // conversion back to the storage type instead of overflowing.
+  friend constexpr auto operator+(const fixed_point lhs,
+                                  const fixed_point rhs) noexcept
+      -> fixed_point {
+    return from_raw(static_cast<Storage>(wide_type{lhs.unwrap()} +
+                                         wide_type{rhs.unwrap()}));
+  }
+
+  friend constexpr auto operator-(const fixed_point lhs,
+                                  const fixed_point rhs) noexcept
+      -> fixed_point {
+    return from_raw(static_cast<Storage>(wide_type{lhs.unwrap()} -
+                                         wide_type{rhs.unwrap()}));
+  }
+
+  // The product of two values has 2 * FractionalBits fractional bits in the
+  // double-width type; the extra bits are dropped with a shift. A negative
+  // product is biased by one - 1 first so that, like division, the result is
+  // truncated toward zero rather than floored.
+  friend constexpr auto operator*(const fixed_point lhs,
+                                  const fixed_point rhs) noexcept
+      -> fixed_point {
+    const wide_type product = wide_type{lhs.unwrap()} * wide_type{rhs.unwrap()};
+    return from_raw(static_cast<Storage>(
+        (product < 0 ? product + (one - 1) : product) >> FractionalBits));
+  }
+
+  // The dividend is pre-scaled by FractionalBits in the double-width type so
+  // that the quotient keeps full precision. The quotient is truncated toward
+  // zero.
+  friend constexpr auto operator/(const fixed_point lhs,
+                                  const fixed_point rhs) noexcept
+      -> fixed_point {
+    return from_raw(static_cast<Storage>((wide_type{lhs.unwrap()} * one) /
+                                         wide_type{rhs.unwrap()}));
+  }
+
+  friend constexpr auto operator-(const fixed_point value) noexcept
+      -> fixed_point {
+    return from_raw(static_cast<Storage>(-wide_type{value.unwrap()}));
+  }
+
+  friend constexpr auto operator+=(fixed_point& lhs,
+                                   const fixed_point rhs) noexcept
+      -> fixed_point& {
+    return lhs = lhs + rhs;
+  }
+
+  friend constexpr auto operator-=(fixed_point& lhs,
+                                   const fixed_point rhs) noexcept
+      -> fixed_point& {
+    return lhs = lhs - rhs;
+  }
+
+  friend constexpr auto operator*=(fixed_point& lhs,
+                                   const fixed_point rhs) noexcept
+      -> fixed_point& {
+    return lhs = lhs * rhs;
+  }
+
+  friend constexpr auto operator/=(fixed_point& lhs,
+                                   const fixed_point rhs) noexcept
+      -> fixed_point& {
+    return lhs = lhs / rhs;
+  }
+
+  template <typename CharT, typename Traits>
+  friend auto operator<<(std::basic_ostream<CharT, Traits>& os,
+                         const fixed_point value)
+      -> std::basic_ostream<CharT, Traits>& {
+    return os << static_cast<double>(value);
+  }
+};
+
+///////////////////////
+// --- Decimal Type ---
+///////////////////////
+
+/// \brief Rounding modes for \c decimal arithmetic and conversions.
+enum class rounding {
+  /// \brief Round to nearest, ties to the even neighbor (banker's rounding).
+  half_even,
+  /// \brief Round to nearest, ties away from zero.
+  half_away_from_zero,
+  /// \brief Round to nearest, ties toward zero.
+  half_toward_zero,
+  /// \brief Round toward zero, i.e. drop the excess digits.
+  truncate,
+  /// \brief Round away from zero.
+  away_from_zero,
+  /// \brief Round toward negative infinity.
+  floor,
+  /// \brief Round toward positive infinity.
+  ceiling,
+};
+
+/// \cond
+namespace _detail {
+// std::make_unsigned is not required to support the 128-bit extension types.
+#ifdef __SIZEOF_INT128__
+template <int Digits>
+using _decimal_storage_t =
+    std::conditional_t<(Digits <= 18), std::int64_t, _int128_t>;
+template <typename T>
+using _decimal_unsigned_t =
+    std::conditional_t<(sizeof(T) <= sizeof(std::uint64_t)), std::uint64_t,
+                       _uint128_t>;
+using _decimal_wide_t = _int128_t;
+#else
+template <int Digits> using _decimal_storage_t = std::int64_t;
+template <typename T> using _decimal_unsigned_t = std::uint64_t;
+using _decimal_wide_t = std::int64_t;
+#endif
+
+template <typename T> constexpr auto _pow10(const int exponent) noexcept -> T {
+  T result = 1;
+  for (int i = 0; i < exponent; ++i) {
+    result *= 10;
+  }
+  return result;
+}
+
+// Rounds the truncated quotient of a division by d according to Mode, given
+// the remainder of that division. The remainder is compared with the distance
+// to the next multiple of d, so no intermediate overflows.
+template <rounding Mode, typename T>
+constexpr auto _round_quotient(const T quotient, const T remainder,
+                               const T d) noexcept -> T {
+  if (remainder == 0) {
+    return quotient;
+  }
+  // A nonzero remainder has the sign of the dividend.
+  const bool negative = (remainder < 0) != (d < 0);
+  const T away = negative ? quotient - 1 : quotient + 1;
+  if constexpr (Mode == rounding::truncate) {
+    return quotient;
+  } else if constexpr (Mode == rounding::away_from_zero) {
+    return away;
+  } else if constexpr (Mode == rounding::floor) {
+    return negative ? away : quotient;
+  } else if constexpr (Mode == rounding::ceiling) {
+    return negative ? quotient : away;
+  } else {
+    const T below = remainder < 0 ? -remainder : remainder;
+    const T above = d < 0 ? -(d + below) : d - below;
+    if (below != above) {
+      return below < above ? quotient : away;
+    }
+    if constexpr (Mode == rounding::half_even) {
+      return quotient % 2 == 0 ? quotient : away;
+    } else if constexpr (Mode == rounding::half_away_from_zero) {
+      return away;
+    } else {
+      return quotient;
+    }
+  }
+}
+
+// Returns n / d rounded according to Mode.
+template <rounding Mode, typename T>
+constexpr auto _divide_rounded(const T n, const T d) noexcept -> T {
+  return _round_quotient<Mode>(T(n / d), T(n % d), d);
+}
+} // namespace _detail
+/// \endcond
+
+template <typename Tag, int Digits, int Scale>
+  requires(Digits > 0 && Scale >= 0 && Scale <= Digits &&
+           Digits <= _detail::_decimal_max_digits)
+class CINA_EBCO decimal
+    : public strong_type<Tag, _detail::_decimal_storage_t<Digits>>,
+      public equality_comparison::skill<decimal<Tag, Digits, Scale>>,
+      public three_way_comparison::skill<decimal<Tag, Digits, Scale>> {
+  using base_type = strong_type<Tag, _detail::_decimal_storage_t<Digits>>;
+  using storage = _detail::_decimal_storage_t<Digits>;
+  using unsigned_storage = _detail::_decimal_unsigned_t<storage>;
+  using wide_type = _detail::_decimal_wide_t;
+
+  // Products of in-range values with up to 18 digits fit in 64 bits, which
+  // avoids a 128-bit division for the common money formats.
+  using product_type =
+      std::conditional_t<(Digits + Scale <= 18), std::int64_t, wide_type>;
+
+  static constexpr storage one = _detail::_pow10<storage>(Scale);
+
+  // Products and quotients of in-range values are exact in the wide type.
+  static constexpr bool _has_wide_product =
+      Digits + Scale <= _detail::_decimal_max_digits;
+
+public:
+  /// \brief The signed integer type holding the scaled value.
+  using storage_type = storage;
+
+  /// \brief The number of significant decimal digits.
+  static constexpr int digits = Digits;
+
+  /// \brief The number of decimal digits after the decimal point.
+  static constexpr int scale = Scale;
+
+  /// \brief The longest text written by \c to_chars: sign, every digit of the
+  /// storage type, point and a leading zero.
+  static constexpr int max_chars =
+      (sizeof(storage) <= sizeof(std::int64_t) ? 19 : 39) + 3;
+
+  /// \brief Constructs a value from its scaled integer representation.
+  [[nodiscard]] static constexpr auto from_raw(const storage raw) noexcept
+      -> decimal {
+    return decimal{std::in_place, raw};
+  }
+
+  explicit decimal(const uninitialized_t) : base_type(uninitialized) {}
+
+  /// \brief Constructs the value equal to the integer \c value.
+  template <cxx_mathematical_signed_integer I>
+  constexpr explicit decimal(const I value) noexcept
+      : base_type(std::in_place, static_cast<storage>(value) * one) {}
+
+  /// \brief Returns the scaled integer representation.
+  [[nodiscard]] constexpr auto raw() const noexcept -> storage {
+    return this->unwrap();
+  }
+
+  /// \brief Returns the product of \c lhs and \c rhs rounded to \c Scale
+  /// digits according to \c Mode.
+  ///
+  /// The integer part of \c lhs is multiplied exactly; only the product of
+  /// its fractional part is divided by <tt>10^Scale</tt>. The rounding
+  /// decision is made on the complete quotient, so ties to even see the
+  /// parity of the result rather than of the fractional contribution.
+  template <rounding Mode>
+  [[nodiscard]] friend constexpr auto multiply(const decimal lhs,
+                                               const decimal rhs) noexcept
+      -> decimal
+    requires _has_wide_product
+  {
+    const product_type whole = lhs.unwrap() / one;
+    const product_type part = lhs.unwrap() % one;
+    const product_type rhs_raw = rhs.unwrap();
+    // Both partial products have the sign of the exact product, so their
+    // truncated quotients add up to the truncated quotient of the total.
+    const product_type scaled = part * rhs_raw;
+    return from_raw(static_cast<storage>(_detail::_round_quotient<Mode>(
+        product_type(whole * rhs_raw + scaled / one),
+        product_type(scaled % one), product_type{one})));
+  }
+
+  /// \brief Returns the quotient of \c lhs and \c rhs rounded to \c Scale
+  /// digits according to \c Mode.
+  ///
+  /// \pre \c rhs is not zero.
+  template <rounding Mode>
+  [[nodiscard]] friend constexpr auto divide(const decimal lhs,
+                                             const decimal rhs) noexcept
+      -> decimal
+    requires _has_wide_product
+  {
+    const product_type whole = lhs.unwrap() / rhs.unwrap();
+    const product_type part = lhs.unwrap() % rhs.unwrap();
+    const product_type rhs_raw = rhs.unwrap();
+    const product_type scaled = part * one;
+    return from_raw(static_cast<storage>(_detail::_round_quotient<Mode>(
+        product_type(whole * one + scaled / rhs_raw),
+        product_type(scaled % rhs_raw), rhs_raw)));
+  }
+
+  /// \brief Writes \c value with exactly \c Scale fractional digits.
+  ///
+  /// The output has the form <tt>-?[0-9]+(\.[0-9]{Scale})?</tt>. On failure
+  /// the result is \c std::errc::value_too_large and nothing is written.
+  friend constexpr auto to_chars(char* const first, char* const last,
+                                 const decimal value) noexcept
+      -> std::to_chars_result {
+    char buffer[max_chars];
+    char* const end = buffer + max_chars;
+    char* p = end;
+    const storage raw = value.unwrap();
+    unsigned_storage magnitude =
+        raw < 0 ? unsigned_storage{0} - static_cast<unsigned_storage>(raw)
+                : static_cast<unsigned_storage>(raw);
+    for (int i = 0; i < Scale; ++i) {
+      *--p = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    }
+    if constexpr (Scale > 0) {
+      *--p = '.';
+    }
+    do {
+      *--p = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+    if (raw < 0) {
+      *--p = '-';
+    }
+    if (last - first < end - p) {
+      return {last, std::errc::value_too_large};
+    }
+    char* out = first;
+    while (p != end) {
+      *out++ = *p++;
+    }
+    return {out, std::errc{}};
+  }
+
+  /// \brief Parses a decimal number of the form <tt>-?[0-9]*(\.[0-9]*)?</tt>
+  /// with at least one digit.
+  ///
+  /// Fractional digits beyond \c Scale are rounded half to even, as
+  /// \c std::from_chars does for floating-point types. If the value has more
+  /// than \c Digits significant digits the result is
+  /// \c std::errc::result_out_of_range and \c value is left unchanged.
+  friend constexpr auto from_chars(const char* const first,
+                                   const char* const last,
+                                   decimal& value) noexcept
+      -> std::from_chars_result {
+    constexpr unsigned_storage integer_limit =
+        _detail::_pow10<unsigned_storage>(Digits - Scale);
+    const auto is_digit = [](const char c) { return c >= '0' && c <= '9'; };
+    const char* p = first;
+    const bool negative = p != last && *p == '-';
+    if (negative) {
+      ++p;
+    }
+
+    bool any_digit = false;
+    bool too_large = false;
+    unsigned_storage magnitude = 0;
+    for (; p != last && is_digit(*p); ++p) {
+      any_digit = true;
+      const auto digit = static_cast<unsigned_storage>(*p - '0');
+      too_large = too_large || magnitude > (integer_limit - 1) / 10 ||
+                  magnitude * 10 + digit >= integer_limit;
+      magnitude = too_large ? magnitude : magnitude * 10 + digit;
+    }
+
+    int fraction_digits = 0;
+    int round_digit = 0;
+    bool sticky = false;
+    if (p != last && *p == '.') {
+      for (++p; p != last && is_digit(*p); ++p) {
+        any_digit = true;
+        const int digit = *p - '0';
+        if (fraction_digits < Scale) {
+          magnitude = magnitude * 10 + static_cast<unsigned_storage>(digit);
+          ++fraction_digits;
+        } else if (fraction_digits == Scale) {
+          round_digit = digit;
+          ++fraction_digits;
+        } else {
+          sticky = sticky || digit != 0;
+        }
+      }
+    }
+    if (!any_digit) {
+      return {first, std::errc::invalid_argument};
+    }
+
+    for (; fraction_digits < Scale; ++fraction_digits) {
+      magnitude *= 10;
+    }
+    if (round_digit > 5 ||
+        (round_digit == 5 && (sticky || magnitude % 2 != 0))) {
+      ++magnitude;
+    }
+    if (too_large ||
+        magnitude >= integer_limit * static_cast<unsigned_storage>(one)) {
+      return {p, std::errc::result_out_of_range};
+    }
+    const auto raw = static_cast<storage>(magnitude);
+    value = from_raw(negative ? -raw : raw);
+    return {p, std::errc{}};
+  }
+
+private:
+  constexpr decimal(std::in_place_t, const storage raw) noexcept
+      : base_type(std::in_place, raw) {}
+
+  // Sums and differences are plain integer operations so that loops over
+  // decimals vectorize exactly like loops over integers.
+  friend constexpr auto operator+(const decimal lhs, const decimal rhs) noexcept
+      -> decimal {
+    return from_raw(lhs.unwrap() + rhs.unwrap());
+  }
+
+  friend constexpr auto operator-(const decimal lhs, const decimal rhs) noexcept
+      -> decimal {
+    return from_raw(lhs.unwrap() - rhs.unwrap());
+  }
+
+  friend constexpr auto operator-(const decimal value) noexcept -> decimal {
+    return from_raw(-value.unwrap());
+  }
+
+  // Scaling by an integer is exact.
+  template <cxx_mathematical_signed_integer I>
+  friend constexpr auto operator*(const decimal lhs, const I rhs) noexcept
+      -> decimal {
+    return from_raw(static_cast<storage>(lhs.unwrap() * rhs));
+  }
+
+  template <cxx_mathematical_signed_integer I>
+  friend constexpr auto operator*(const I lhs, const decimal rhs) noexcept
+      -> decimal {
+    return rhs * lhs;
+  }
+
+  // Products and quotients of two decimals round half to even. Use multiply
+  // and divide to select another rounding mode.
+  friend constexpr auto operator*(const decimal lhs, const decimal rhs) noexcept
+      -> decimal
+    requires _has_wide_product
+  {
+    return multiply<rounding::half_even>(lhs, rhs);
+  }
+
+  friend constexpr auto operator/(const decimal lhs, const decimal rhs) noexcept
+      -> decimal
+    requires _has_wide_product
+  {
+    return divide<rounding::half_even>(lhs, rhs);
+  }
+
+  friend constexpr auto operator+=(decimal& lhs, const decimal rhs) noexcept
+      -> decimal& {
+    return lhs = lhs + rhs;
+  }
+
+  friend constexpr auto operator-=(decimal& lhs, const decimal rhs) noexcept
+      -> decimal& {
+    return lhs = lhs - rhs;
+  }
+
+  template <cxx_mathematical_signed_integer I>
+  friend constexpr auto operator*=(decimal& lhs, const I rhs) noexcept
+      -> decimal& {
+    return lhs = lhs * rhs;
+  }
+
+  friend constexpr auto operator*=(decimal& lhs, const decimal rhs) noexcept
+      -> decimal&
+    requires _has_wide_product
+  {
+    return lhs = lhs * rhs;
+  }
+
+  friend constexpr auto operator/=(decimal& lhs, const decimal rhs) noexcept
+      -> decimal&
+    requires _has_wide_product
+  {
+    return lhs = lhs / rhs;
+  }
+
+  template <typename CharT, typename Traits>
+  friend auto operator<<(std::basic_ostream<CharT, Traits>& os,
+                         const decimal value)
+      -> std::basic_ostream<CharT, Traits>& {
+    char buffer[max_chars];
+    const auto result = to_chars(buffer, buffer + max_chars, value);
+    return os << std::string_view(buffer, result.ptr);
+  }
+};
+
+/// \brief Converts \c value to the decimal type \c To of the same tag,
+/// rounding according to \c Mode if \c To has fewer fractional digits.
+///
+/// \tparam To The target decimal type.
+/// \tparam Mode The rounding mode used when digits are dropped.
+template <typename To, rounding Mode = rounding::half_even, typename Tag,
+          int Digits, int Scale>
+  requires std::same_as<To, decimal<Tag, To::digits, To::scale>>
+[[nodiscard]] constexpr auto decimal_cast(
+    const decimal<Tag, Digits, Scale> value) noexcept -> To {
+  using wide_type = _detail::_decimal_wide_t;
+  const wide_type raw = value.raw();
+  if constexpr (To::scale >= Scale) {
+    return To::from_raw(static_cast<typename To::storage_type>(
+        raw * _detail::_pow10<wide_type>(To::scale - Scale)));
+  } else {
+    return To::from_raw(static_cast<typename To::storage_type>(
+        _detail::_divide_rounded<Mode>(
+            raw, _detail::_pow10<wide_type>(Scale - To::scale))));
+  }
+}
+
+///////////////////////////
+// --- Enumeration Type ---
+///////////////////////////
+
+/// \cond
+namespace _detail {
+// Enumerators are found by instantiating _enum_signature for every value in
+// this range. The compiler spells an enumerator by name and any other value
+// as a cast, e.g. "(color)7".
+inline constexpr std::intmax_t _enum_search_min = -128;
+inline constexpr std::intmax_t _enum_search_max = 255;
+
+template <auto V> constexpr auto _enum_signature() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  const std::string_view signature = __FUNCSIG__;
+  return signature.substr(0, signature.rfind('>'));
+#else
+  const std::string_view signature = __PRETTY_FUNCTION__;
+  return signature.substr(0, signature.rfind(']'));
+#endif
+}
+
+template <auto V> constexpr auto _enum_name() noexcept -> std::string_view {
+  constexpr std::string_view signature = _enum_signature<V>();
+  const auto is_identifier = [](const char c) {
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9');
+  };
+  std::size_t begin = signature.size();
+  while (begin > 0 && is_identifier(signature[begin - 1])) {
+    --begin;
+  }
+  const std::string_view name = signature.substr(begin);
+  if (name.empty() || (name[0] >= '0' && name[0] <= '9')) {
+    return {};
+  }
+  return name;
+}
+
+template <typename E, std::intmax_t Lo, std::size_t... I>
+constexpr auto _enum_names_from(std::index_sequence<I...>) noexcept
+    -> std::array<std::string_view, sizeof...(I)> {
+  return {_enum_name<static_cast<E>(Lo + static_cast<std::intmax_t>(I))>()...};
+}
+
+// Reads up to eight bytes of name starting at offset as a little-endian
+// word. Reading exactly eight bytes compiles to a single load.
+constexpr auto _name_word(const std::string_view name,
+                          const std::size_t offset) noexcept
+    -> std::uint64_t {
+  std::uint64_t word = 0;
+  if (name.size() - offset >= 8) {
+    for (std::size_t i = 0; i < 8; ++i) {
+      word |= std::uint64_t{static_cast<unsigned char>(name[offset + i])}
+              << (8 * i);
+    }
+  } else {
+    for (std::size_t i = 0; offset + i < name.size(); ++i) {
+      word |= std::uint64_t{static_cast<unsigned char>(name[offset + i])}
+              << (8 * i);
+    }
+  }
+  return word;
+}
+
+// Hashes the length and the first and last eight bytes of name in constant
+// time. This separates almost every set of identifiers; the others fall back
+// to _full_name_hash.
+constexpr auto _short_name_hash(const std::string_view name) noexcept
+    -> std::uint64_t {
+  const std::size_t tail = name.size() < 8 ? 0 : name.size() - 8;
+  return splitmix64{}(_name_word(name, 0) ^
+                      std::rotl(_name_word(name, tail), 31) ^
+                      (name.size() * 0x9e3779b97f4a7c15U));
+}
+
+// FNV-1a followed by the splitmix64 finalizer.
+constexpr auto _full_name_hash(const std::string_view name) noexcept
+    -> std::uint64_t {
+  std::uint64_t hash = 0xcbf29ce484222325U;
+  for (const char c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3U;
+  }
+  return splitmix64{}(hash);
+}
+
+template <std::size_t N>
+constexpr auto _short_hashes_distinct(
+    const std::array<std::string_view, N>& names) noexcept -> bool {
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = i + 1; j < N; ++j) {
+      if (_short_name_hash(names[i]) == _short_name_hash(names[j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// A minimal perfect hash of N distinct 64-bit hashes built with hash and
+// displace: hashes are grouped into buckets by their low bits, and every
+// bucket, largest first, gets the smallest displacement that moves all of its
+// hashes to free slots.
+template <std::size_t N> struct _hash_displace {
+  static constexpr std::size_t slot_count = 2 * std::bit_ceil(N);
+  static constexpr std::size_t bucket_count = std::bit_ceil((N + 1) / 2);
+
+  // Buckets are selected by the low bits of the hash and slots by the high
+  // bits of its displaced multiplicative hash.
+  static constexpr auto slot_of(const std::uint64_t hash,
+                                const std::uint16_t displacement) noexcept
+      -> std::size_t {
+    constexpr int shift = 64 - std::countr_zero(slot_count);
+    return static_cast<std::size_t>(
+        ((hash + displacement) * 0x9e3779b97f4a7c15U) >> shift);
+  }
+
+  // The displacement of each bucket.
+  std::array<std::uint16_t, bucket_count> displacements{};
+  // The position of the hash in each slot plus one, or zero if empty.
+  std::array<std::uint16_t, slot_count> slots{};
+  bool complete = true;
+
+  constexpr explicit _hash_displace(
+      const std::array<std::uint64_t, N>& hashes) noexcept {
+    std::array<std::size_t, bucket_count> sizes{};
+    for (std::size_t i = 0; i < N; ++i) {
+      ++sizes[hashes[i] & (bucket_count - 1)];
+    }
+    for (std::size_t size = N; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        if (sizes[bucket] == size) {
+          complete = complete && place(hashes, bucket);
+        }
+      }
+    }
+  }
+
+  // Returns the position of hash plus one if it is in the slot it hashes
+  // to, or zero. Any other hash returns an arbitrary position or zero.
+  [[nodiscard]] constexpr auto entry(const std::uint64_t hash) const noexcept
+      -> std::uint16_t {
+    return slots[slot_of(hash, displacements[hash & (bucket_count - 1)])];
+  }
+
+private:
+  constexpr auto place(const std::array<std::uint64_t, N>& hashes,
+                       const std::size_t bucket) noexcept -> bool {
+    for (std::uint32_t d = 0; d <= 0xffff; ++d) {
+      const auto displacement = static_cast<std::uint16_t>(d);
+      bool fits = true;
+      for (std::size_t i = 0; i < N && fits; ++i) {
+        if ((hashes[i] & (bucket_count - 1)) == bucket) {
+          std::uint16_t& slot = slots[slot_of(hashes[i], displacement)];
+          fits = slot == 0;
+          slot = fits ? static_cast<std::uint16_t>(i + 1) : slot;
+        }
+      }
+      if (fits) {
+        displacements[bucket] = displacement;
+        return true;
+      }
+      for (std::size_t i = 0; i < N; ++i) {
+        if ((hashes[i] & (bucket_count - 1)) == bucket) {
+          std::uint16_t& slot = slots[slot_of(hashes[i], displacement)];
+          slot = slot == i + 1 ? 0 : slot;
+        }
+      }
+    }
+    return false;
+  }
+};
+
+// The hash and displace index of N names.
+template <std::size_t N, bool FullHash>
+struct _name_index : public _hash_displace<N> {
+  static constexpr auto hash(const std::string_view name) noexcept
+      -> std::uint64_t {
+    if constexpr (FullHash) {
+      return _full_name_hash(name);
+    } else {
+      return _short_name_hash(name);
+    }
+  }
+
+  static constexpr auto hashes(const std::array<std::string_view, N>& names)
+      noexcept -> std::array<std::uint64_t, N> {
+    std::array<std::uint64_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i) {
+      result[i] = hash(names[i]);
+    }
+    return result;
+  }
+
+  constexpr explicit _name_index(
+      const std::array<std::string_view, N>& names) noexcept
+      : _hash_displace<N>(hashes(names)) {}
+
+  // Returns the only position whose name may equal name, or N.
+  [[nodiscard]] constexpr auto find(const std::string_view name) const noexcept
+      -> std::size_t {
+    const std::uint16_t entry = this->entry(hash(name));
+    return entry == 0 ? N : entry - 1U;
+  }
+};
+
+template <typename E> struct _enum_info {
+  using underlying = std::underlying_type_t<E>;
+
+  static constexpr std::intmax_t search_min =
+      std::cmp_less(std::numeric_limits<underlying>::min(), _enum_search_min)
+          ? _enum_search_min
+          : std::numeric_limits<underlying>::min();
+  static constexpr std::intmax_t search_max =
+      std::cmp_greater(std::numeric_limits<underlying>::max(),
+                       _enum_search_max)
+          ? _enum_search_max
+          : std::numeric_limits<underlying>::max();
+
+  static constexpr auto candidates = _enum_names_from<E, search_min>(
+      std::make_index_sequence<search_max - search_min + 1>{});
+
+  static constexpr std::size_t size = [] {
+    std::size_t count = 0;
+    for (const std::string_view name : candidates) {
+      count += name.empty() ? 0 : 1;
+    }
+    return count;
+  }();
+
+  // The enumerators in ascending order of value and their names.
+  static constexpr std::array<E, size> values = [] {
+    std::array<E, size> result{};
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+      if (!candidates[i].empty()) {
+        result[pos++] =
+            static_cast<E>(search_min + static_cast<std::intmax_t>(i));
+      }
+    }
+    return result;
+  }();
+
+  static constexpr std::array<std::string_view, size> names = [] {
+    std::array<std::string_view, size> result{};
+    std::size_t pos = 0;
+    for (const std::string_view name : candidates) {
+      if (!name.empty()) {
+        result[pos++] = name;
+      }
+    }
+    return result;
+  }();
+
+  static constexpr std::intmax_t min =
+      size == 0 ? 0 : static_cast<std::intmax_t>(values.front());
+  static constexpr std::intmax_t max =
+      size == 0 ? -1 : static_cast<std::intmax_t>(values.back());
+
+  // If the values are not contiguous, positions are looked up in a table
+  // indexed by value - min; entries of non-enumerators are size.
+  static constexpr bool dense =
+      max - min + 1 == static_cast<std::intmax_t>(size);
+
+  static constexpr auto positions = [] {
+    std::array<std::uint16_t, dense ? 0 : max - min + 1> result{};
+    if constexpr (!dense) {
+      result.fill(static_cast<std::uint16_t>(size));
+      for (std::size_t pos = 0; pos < size; ++pos) {
+        result[static_cast<std::intmax_t>(values[pos]) - min] =
+            static_cast<std::uint16_t>(pos);
+      }
+    }
+    return result;
+  }();
+
+  static constexpr _name_index<size, !_short_hashes_distinct(names)> index{
+      names};
+
+  // Returns the position of value, or size if value is not an enumerator.
+  static constexpr auto position(const E value) noexcept -> std::size_t {
+    const auto offset = static_cast<std::intmax_t>(value) - min;
+    if (offset < 0 || offset > max - min) {
+      return size;
+    }
+    if constexpr (dense) {
+      return static_cast<std::size_t>(offset);
+    } else {
+      return positions[static_cast<std::size_t>(offset)];
+    }
+  }
+};
+} // namespace _detail
+/// \endcond
+
+template <typename Tag, typename Enum>
+  requires std::is_enum_v<Enum>
+class CINA_EBCO enumeration
+    : public strong_type<Tag, Enum>,
+      public equality_comparison::skill<enumeration<Tag, Enum>>,
+      public three_way_comparison::skill<enumeration<Tag, Enum>> {
+  using base_type = strong_type<Tag, Enum>;
+  using info = _detail::_enum_info<Enum>;
+
+  static_assert(info::size > 0,
+                "Enum has no enumerators in the range searched by cina");
+  static_assert(info::index.complete,
+                "no perfect hash was found for the enumerator names");
+
+public:
+  /// \brief The wrapped enumeration type.
+  using enum_type = Enum;
+
+  /// \brief The number of enumerators.
+  static constexpr std::size_t size = info::size;
+
+  explicit enumeration(const uninitialized_t) : base_type(uninitialized) {}
+
+  /// \brief Constructs the enumeration value \c value.
+  ///
+  /// \throws constraint_error if \c value is not an enumerator of \c Enum.
+  constexpr explicit enumeration(const Enum value)
+      : base_type(std::in_place, value) {
+    if (info::position(value) == size) {
+      throw constraint_error{"value is not an enumerator of the type"};
+    }
+  }
+
+  /// \brief Returns the enumerator with the smallest value.
+  [[nodiscard]] static constexpr auto first() noexcept -> enumeration {
+    return enumeration{std::in_place, info::values.front()};
+  }
+
+  /// \brief Returns the enumerator with the largest value.
+  [[nodiscard]] static constexpr auto last() noexcept -> enumeration {
+    return enumeration{std::in_place, info::values.back()};
+  }
+
+  /// \brief Returns the enumerator at position \c pos, i.e. Ada's \c 'Val.
+  ///
+  /// \throws constraint_error if \c pos is not less than \c size.
+  [[nodiscard]] static constexpr auto from_pos(const std::size_t pos)
+      -> enumeration {
+    if (pos >= size) {
+      throw constraint_error{"position is outside the range of the type"};
+    }
+    return enumeration{std::in_place, info::values[pos]};
+  }
+
+  /// \brief Returns the enumerator named \c name, i.e. Ada's \c 'Value.
+  ///
+  /// The name is looked up with a perfect hash computed at compile time, so
+  /// at most one name is compared.
+  [[nodiscard]] static constexpr auto
+  from_string(const std::string_view name) noexcept
+      -> std::optional<enumeration> {
+    const std::size_t pos = info::index.find(name);
+    if (pos == size || info::names[pos] != name) {
+      return std::nullopt;
+    }
+    return enumeration{std::in_place, info::values[pos]};
+  }
+
+  /// \brief Returns the names of all enumerators in order of position.
+  [[nodiscard]] static constexpr auto names() noexcept
+      -> std::span<const std::string_view, size> {
+    return info::names;
+  }
+
+  /// \brief Returns the position of the value, i.e. Ada's \c 'Pos.
+  [[nodiscard]] constexpr auto pos() const noexcept -> std::size_t {
+    return info::position(this->unwrap());
+  }
+
+  /// \brief Returns the name of the enumerator, i.e. Ada's \c 'Image.
+  [[nodiscard]] constexpr auto name() const noexcept -> std::string_view {
+    return info::names[pos()];
+  }
+
+  /// \brief Returns the next enumerator, i.e. Ada's \c 'Succ.
+  ///
+  /// \throws constraint_error if the value is \c last().
+  [[nodiscard]] constexpr auto succ() const -> enumeration {
+    return from_pos(pos() + 1);
+  }
+
+  /// \brief Returns the previous enumerator, i.e. Ada's \c 'Pred.
+  ///
+  /// \throws constraint_error if the value is \c first().
+  [[nodiscard]] constexpr auto pred() const -> enumeration {
+    return from_pos(pos() - 1);
+  }
+
+private:
+  constexpr enumeration(std::in_place_t, const Enum value) noexcept
+      : base_type(std::in_place, value) {}
+
+  template <typename Traits>
+  friend auto operator<<(std::basic_ostream<char, Traits>& os,
+                         const enumeration value)
+      -> std::basic_ostream<char, Traits>& {
+    return os << value.name();
+  }
+};
+
+/////////////////////
+// --- Flags Type ---
+/////////////////////
+
+/// \cond
+namespace _detail {
+template <std::size_t N>
+using _flags_storage_t = std::conditional_t<
+    (N <= 8), std::uint8_t,
+    std::conditional_t<(N <= 16), std::uint16_t,
+                       std::conditional_t<(N <= 32), std::uint32_t,
+                                          std::uint64_t>>>;
+
+// Counts the set bits of every byte in parallel and sums the bytes with a
+// multiplication. Unlike std::popcount it needs no popcnt instruction, and
+// loops over it vectorize.
+constexpr auto _popcount_bytes(std::uint64_t x) noexcept -> std::uint64_t {
+  x = x - ((x >> 1) & 0x5555555555555555U);
+  x = (x & 0x3333333333333333U) + ((x >> 2) & 0x3333333333333333U);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fU;
+  return (x * 0x0101010101010101U) >> 56;
+}
+} // namespace _detail
+/// \endcond
+
+template <typename Tag, typename Enum>
+  requires std::is_enum_v<Enum>
+class CINA_EBCO flags
+    : public strong_type<
+          Tag, _detail::_flags_storage_t<_detail::_enum_info<Enum>::size>>,
+      public equality_comparison::skill<flags<Tag, Enum>> {
+  using info = _detail::_enum_info<Enum>;
+  using storage = _detail::_flags_storage_t<info::size>;
+  using base_type = strong_type<Tag, storage>;
+
+  static_assert(info::size > 0 && info::size <= 64,
+                "flags requires between 1 and 64 enumerators");
+
+  static constexpr storage all_bits =
+      info::size == std::numeric_limits<storage>::digits
+          ? static_cast<storage>(~storage{0})
+          : static_cast<storage>((storage{1} << info::size) - 1);
+
+  // Non-enumerators map to the empty mask.
+  static constexpr auto _bit(const Enum value) noexcept -> storage {
+    const std::size_t pos = info::position(value);
+    return pos < info::size ? static_cast<storage>(storage{1} << pos)
+                            : storage{0};
+  }
+
+public:
+  /// \brief The enumeration type of the flags.
+  using enum_type = Enum;
+
+  /// \brief The unsigned integer type holding the bits.
+  using storage_type = storage;
+
+  /// \brief The number of flags.
+  static constexpr std::size_t size = info::size;
+
+  /// \brief Iterator over the flags in a set, in order of position.
+  class iterator {
+  public:
+    // reference is a prvalue, which the Cpp17 iterator requirements allow
+    // only for input iterators.
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Enum;
+    using difference_type = std::ptrdiff_t;
+    using reference = Enum;
+
+    constexpr iterator() noexcept = default;
+
+    [[nodiscard]] constexpr auto operator*() const noexcept -> Enum {
+      return info::values[static_cast<std::size_t>(std::countr_zero(_m_bits))];
+    }
+
+    constexpr auto operator++() noexcept -> iterator& {
+      _m_bits = static_cast<storage>(_m_bits & (_m_bits - 1));
+      return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> iterator {
+      iterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const iterator lhs,
+                                                   const iterator rhs) noexcept
+        -> bool = default;
+
+  private:
+    friend flags;
+
+    constexpr explicit iterator(const storage bits) noexcept : _m_bits(bits) {}
+
+    storage _m_bits = 0;
+  };
+
+  /// \brief Constructs the empty set.
+  constexpr flags() noexcept : base_type(std::in_place, storage{0}) {}
+
+  explicit flags(const uninitialized_t) : base_type(uninitialized) {}
+
+  /// \brief Constructs the set of \c values.
+  constexpr flags(const std::initializer_list<Enum> values) noexcept
+      : base_type(std::in_place, storage{0}) {
+    for (const Enum value : values) {
+      insert(value);
+    }
+  }
+
+  /// \brief Returns the empty set.
+  [[nodiscard]] static constexpr auto none() noexcept -> flags {
+    return flags{};
+  }
+
+  /// \brief Returns the set of all flags.
+  [[nodiscard]] static constexpr auto all() noexcept -> flags {
+    return from_bits(all_bits);
+  }
+
+  /// \brief Constructs a set from its bits.
+  ///
+  /// \throws constraint_error if a bit at or above \c size is set.
+  [[nodiscard]] static constexpr auto from_raw(const storage raw) -> flags {
+    if ((raw & ~all_bits) != 0) {
+      throw constraint_error{"bit is outside the range of the type"};
+    }
+    return from_bits(raw);
+  }
+
+  /// \brief Returns the bits of the set.
+  [[nodiscard]] constexpr auto raw() const noexcept -> storage {
+    return this->unwrap();
+  }
+
+  /// \brief Returns whether \c value is in the set.
+  [[nodiscard]] constexpr auto contains(const Enum value) const noexcept
+      -> bool {
+    return (this->unwrap() & _bit(value)) != 0;
+  }
+
+  /// \brief Returns whether every flag of \c other is in the set.
+  [[nodiscard]] constexpr auto contains(const flags other) const noexcept
+      -> bool {
+    return (this->unwrap() & other.unwrap()) == other.unwrap();
+  }
+
+  /// \brief Returns whether the set and \c other have a flag in common.
+  [[nodiscard]] constexpr auto intersects(const flags other) const noexcept
+      -> bool {
+    return (this->unwrap() & other.unwrap()) != 0;
+  }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return this->unwrap() == 0;
+  }
+
+  /// \brief Returns the number of flags in the set.
+  [[nodiscard]] constexpr auto count() const noexcept -> std::size_t {
+    return static_cast<std::size_t>(std::popcount(this->unwrap()));
+  }
+
+  /// \brief Adds \c value to the set.
+  constexpr auto insert(const Enum value) noexcept -> flags& {
+    this->unwrap() = static_cast<storage>(this->unwrap() | _bit(value));
+    return *this;
+  }
+
+  /// \brief Removes \c value from the set.
+  constexpr auto erase(const Enum value) noexcept -> flags& {
+    this->unwrap() = static_cast<storage>(this->unwrap() & ~_bit(value));
+    return *this;
+  }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> iterator {
+    return iterator{this->unwrap()};
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> iterator {
+    return iterator{};
+  }
+
+  /// \brief Stores the union of each pair of \c lhs and \c rhs in \c out.
+  ///
+  /// \pre \c lhs, \c rhs and \c out have the same size.
+  static constexpr auto bulk_or(const std::span<const flags> lhs,
+                                const std::span<const flags> rhs,
+                                const std::span<flags> out) noexcept -> void {
+    assert(lhs.size() == out.size() && rhs.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      out[i] = from_bits(static_cast<storage>(lhs[i].unwrap() |
+                                              rhs[i].unwrap()));
+    }
+  }
+
+  /// \brief Stores the intersection of each pair of \c lhs and \c rhs in
+  /// \c out.
+  ///
+  /// \pre \c lhs, \c rhs and \c out have the same size.
+  static constexpr auto bulk_and(const std::span<const flags> lhs,
+                                 const std::span<const flags> rhs,
+                                 const std::span<flags> out) noexcept -> void {
+    assert(lhs.size() == out.size() && rhs.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      out[i] = from_bits(static_cast<storage>(lhs[i].unwrap() &
+                                              rhs[i].unwrap()));
+    }
+  }
+
+  /// \brief Returns the total number of flags in \c sets.
+  [[nodiscard]] static constexpr auto
+  bulk_count(const std::span<const flags> sets) noexcept -> std::size_t {
+    std::uint64_t total = 0;
+    for (const flags& set : sets) {
+      total += _detail::_popcount_bytes(set.unwrap());
+    }
+    return static_cast<std::size_t>(total);
+  }
+
+private:
+  [[nodiscard]] static constexpr auto from_bits(const storage bits) noexcept
+      -> flags {
+    flags result;
+    result.unwrap() = bits;
+    return result;
+  }
+
+  friend constexpr auto operator|(const flags lhs, const flags rhs) noexcept
+      -> flags {
+    return from_bits(static_cast<storage>(lhs.unwrap() | rhs.unwrap()));
+  }
+
+  friend constexpr auto operator&(const flags lhs, const flags rhs) noexcept
+      -> flags {
+    return from_bits(static_cast<storage>(lhs.unwrap() & rhs.unwrap()));
+  }
+
+  friend constexpr auto operator^(const flags lhs, const flags rhs) noexcept
+      -> flags {
+    return from_bits(static_cast<storage>(lhs.unwrap() ^ rhs.unwrap()));
+  }
+
+  // The complement is taken within the set of all flags.
+  friend constexpr auto operator~(const flags value) noexcept -> flags {
+    return from_bits(static_cast<storage>(value.unwrap() ^ all_bits));
+  }
+
+  friend constexpr auto operator|=(flags& lhs, const flags rhs) noexcept
+      -> flags& {
+    return lhs = lhs | rhs;
+  }
+
+  friend constexpr auto operator&=(flags& lhs, const flags rhs) noexcept
+      -> flags& {
+    return lhs = lhs & rhs;
+  }
+
+  friend constexpr auto operator^=(flags& lhs, const flags rhs) noexcept
+      -> flags& {
+    return lhs = lhs ^ rhs;
+  }
+
+  // Prints the names of the flags separated by '|', e.g. "read|write".
+  template <typename Traits>
+  friend auto operator<<(std::basic_ostream<char, Traits>& os,
+                         const flags value)
+      -> std::basic_ostream<char, Traits>& {
+    bool first = true;
+    for (const Enum flag : value) {
+      if (!first) {
+        os << '|';
+      }
+      os << info::names[info::position(flag)];
+      first = false;
+    }
+    return os;
+  }
+};
+
+////////////////////////
+// --- Quantity Type ---
+////////////////////////
+
+/// \brief Common dimensions.
+namespace dimensions {
+using dimensionless = dimension<0, 0, 0>;
+using length = dimension<1, 0, 0>;
+using mass = dimension<0, 1, 0>;
+using time = dimension<0, 0, 1>;
+using current = dimension<0, 0, 0, 1>;
+using temperature = dimension<0, 0, 0, 0, 1>;
+using amount = dimension<0, 0, 0, 0, 0, 1>;
+using luminosity = dimension<0, 0, 0, 0, 0, 0, 1>;
+using frequency = dimension<0, 0, -1>;
+using area = dimension<2, 0, 0>;
+using volume = dimension<3, 0, 0>;
+using velocity = dimension<1, 0, -1>;
+using acceleration = dimension<1, 0, -2>;
+using force = dimension<1, 1, -2>;
+using energy = dimension<2, 1, -2>;
+using power = dimension<2, 1, -3>;
+} // namespace dimensions
+
+/// \cond
+namespace _detail {
+template <typename Lhs, typename Rhs> struct _dimension_product;
+template <int... L, int... R>
+struct _dimension_product<dimension<L...>, dimension<R...>> {
+  using type = dimension<(L + R)...>;
+};
+
+template <typename Lhs, typename Rhs> struct _dimension_quotient;
+template <int... L, int... R>
+struct _dimension_quotient<dimension<L...>, dimension<R...>> {
+  using type = dimension<(L - R)...>;
+};
+
+// Converts a value in units of FromRatio to units of ToRatio. The factor is
+// a compile-time constant: the conversion is a single multiplication for
+// floating-point types, a multiplication or division by an integer where
+// the factor allows it, and nothing at all if the ratios are equal.
+template <typename ToRatio, typename ToRep, typename FromRatio,
+          typename FromRep>
+constexpr auto _quantity_convert(const FromRep value) noexcept -> ToRep {
+  using factor = std::ratio_divide<FromRatio, ToRatio>;
+  using common = std::common_type_t<ToRep, FromRep, std::intmax_t>;
+  if constexpr (factor::num == 1 && factor::den == 1) {
+    return static_cast<ToRep>(value);
+  } else if constexpr (std::is_floating_point_v<common>) {
+    constexpr common scale =
+        static_cast<common>(factor::num) / static_cast<common>(factor::den);
+    return static_cast<ToRep>(static_cast<common>(value) * scale);
+  } else if constexpr (factor::den == 1) {
+    return static_cast<ToRep>(static_cast<common>(value) * factor::num);
+  } else if constexpr (factor::num == 1) {
+    return static_cast<ToRep>(static_cast<common>(value) / factor::den);
+  } else {
+    return static_cast<ToRep>(static_cast<common>(value) * factor::num /
+                              factor::den);
+  }
+}
+
+// A conversion is lossless if the target is floating-point or an integral
+// multiple of the source unit.
+template <typename ToRatio, typename ToRep, typename FromRatio,
+          typename FromRep>
+constexpr bool _quantity_lossless =
+    std::is_floating_point_v<ToRep> ||
+    (!std::is_floating_point_v<FromRep> &&
+     std::ratio_divide<FromRatio, ToRatio>::den == 1);
+
+// The largest unit of which both units are integral multiples, as for
+// std::chrono::duration, so that both operands convert to it losslessly.
+template <typename R1, typename R2>
+using _common_ratio_t =
+    typename std::ratio<std::gcd(R1::num, R2::num),
+                        R1::den / std::gcd(R1::den, R2::den) * R2::den>::type;
+
+template <typename Dimension, typename R1, typename Rep1, typename R2,
+          typename Rep2>
+using _common_quantity_t = quantity<Dimension, _common_ratio_t<R1, R2>,
+                                    std::common_type_t<Rep1, Rep2>>;
+} // namespace _detail
+/// \endcond
+
+template <typename Dimension, typename Ratio, typename Rep>
+  requires(_detail::_is_dimension_v<Dimension> &&
+           _detail::_is_ratio_v<Ratio> &&
+           std::same_as<Ratio, typename Ratio::type> &&
+           std::is_arithmetic_v<Rep>)
+class CINA_EBCO quantity
+    : public strong_type<Dimension, Rep>,
+      public equality_comparison::skill<quantity<Dimension, Ratio, Rep>>,
+      public three_way_comparison::skill<quantity<Dimension, Ratio, Rep>>,
+      public output_stream::skill<quantity<Dimension, Ratio, Rep>> {
+  using base_type = strong_type<Dimension, Rep>;
+
+public:
+  /// \brief The dimension of the quantity.
+  using dimension_type = Dimension;
+
+  /// \brief The unit of the quantity as a multiple of the coherent SI unit.
+  using ratio = Ratio;
+
+  /// \brief The arithmetic type holding the value.
+  using rep = Rep;
+
+  template <typename U> using rebind = quantity<Dimension, Ratio, U>;
+
+  explicit quantity(const uninitialized_t) : base_type(uninitialized) {}
+
+  /// \brief Constructs a quantity of \c value units.
+  constexpr explicit quantity(const Rep value) noexcept
+      : base_type(std::in_place, value) {}
+
+  /// \brief Converts from another unit of the same dimension.
+  ///
+  /// The conversion is implicit if it cannot lose precision.
+  template <typename OtherRatio, typename OtherRep>
+  constexpr explicit(
+      !_detail::_quantity_lossless<Ratio, Rep, OtherRatio, OtherRep>)
+      quantity(const quantity<Dimension, OtherRatio, OtherRep> other) noexcept
+      : base_type(std::in_place,
+                  _detail::_quantity_convert<Ratio, Rep, OtherRatio>(
+                      other.unwrap())) {}
+
+private:
+  friend constexpr auto operator+(const quantity lhs,
+                                  const quantity rhs) noexcept -> quantity {
+    return quantity{static_cast<Rep>(lhs.unwrap() + rhs.unwrap())};
+  }
+
+  friend constexpr auto operator-(const quantity lhs,
+                                  const quantity rhs) noexcept -> quantity {
+    return quantity{static_cast<Rep>(lhs.unwrap() - rhs.unwrap())};
+  }
+
+  friend constexpr auto operator-(const quantity value) noexcept
+      -> quantity {
+    return quantity{static_cast<Rep>(-value.unwrap())};
+  }
+
+  friend constexpr auto operator*(const quantity lhs, const Rep rhs) noexcept
+      -> quantity {
+    return quantity{static_cast<Rep>(lhs.unwrap() * rhs)};
+  }
+
+  friend constexpr auto operator*(const Rep lhs, const quantity rhs) noexcept
+      -> quantity {
+    return quantity{static_cast<Rep>(lhs * rhs.unwrap())};
+  }
+
+  friend constexpr auto operator/(const quantity lhs, const Rep rhs) noexcept
+      -> quantity {
+    return quantity{static_cast<Rep>(lhs.unwrap() / rhs)};
+  }
+
+  friend constexpr auto operator+=(quantity& lhs, const quantity rhs) noexcept
+      -> quantity& {
+    return lhs = lhs + rhs;
+  }
+
+  friend constexpr auto operator-=(quantity& lhs, const quantity rhs) noexcept
+      -> quantity& {
+    return lhs = lhs - rhs;
+  }
+
+  friend constexpr auto operator*=(quantity& lhs, const Rep rhs) noexcept
+      -> quantity& {
+    return lhs = lhs * rhs;
+  }
+
+  friend constexpr auto operator/=(quantity& lhs, const Rep rhs) noexcept
+      -> quantity& {
+    return lhs = lhs / rhs;
+  }
+};
+
+/// \brief Returns the product of two quantities, whose dimension and unit are
+/// the products of theirs.
+template <typename D1, typename R1, typename Rep1, typename D2, typename R2,
+          typename Rep2>
+[[nodiscard]] constexpr auto
+operator*(const quantity<D1, R1, Rep1> lhs,
+          const quantity<D2, R2, Rep2> rhs) noexcept
+    -> quantity<typename _detail::_dimension_product<D1, D2>::type,
+                std::ratio_multiply<R1, R2>, std::common_type_t<Rep1, Rep2>> {
+  using result =
+      quantity<typename _detail::_dimension_product<D1, D2>::type,
+               std::ratio_multiply<R1, R2>, std::common_type_t<Rep1, Rep2>>;
+  return result{static_cast<typename result::rep>(lhs.unwrap() *
+                                                  rhs.unwrap())};
+}
+
+/// \brief Returns the quotient of two quantities, whose dimension and unit
+/// are the quotients of theirs.
+template <typename D1, typename R1, typename Rep1, typename D2, typename R2,
+          typename Rep2>
+[[nodiscard]] constexpr auto
+operator/(const quantity<D1, R1, Rep1> lhs,
+          const quantity<D2, R2, Rep2> rhs) noexcept
+    -> quantity<typename _detail::_dimension_quotient<D1, D2>::type,
+                std::ratio_divide<R1, R2>, std::common_type_t<Rep1, Rep2>> {
+  using result =
+      quantity<typename _detail::_dimension_quotient<D1, D2>::type,
+               std::ratio_divide<R1, R2>, std::common_type_t<Rep1, Rep2>>;
+  return result{static_cast<typename result::rep>(lhs.unwrap() /
+                                                  rhs.unwrap())};
+}
+
+/// \brief Returns the sum of two quantities of the same dimension in
+/// different units or representations, in their common unit.
+///
+/// Both operands convert losslessly to the common unit, so the result does
+/// not depend on which unit is written first.
+template <typename D, typename R1, typename Rep1, typename R2, typename Rep2>
+  requires(!std::same_as<quantity<D, R1, Rep1>, quantity<D, R2, Rep2>>)
+[[nodiscard]] constexpr auto operator+(const quantity<D, R1, Rep1> lhs,
+                                       const quantity<D, R2, Rep2> rhs) noexcept
+    -> _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2> {
+  using common = _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2>;
+  return common{lhs} + common{rhs};
+}
+
+/// \brief Returns the difference of two quantities of the same dimension in
+/// different units or representations, in their common unit.
+template <typename D, typename R1, typename Rep1, typename R2, typename Rep2>
+  requires(!std::same_as<quantity<D, R1, Rep1>, quantity<D, R2, Rep2>>)
+[[nodiscard]] constexpr auto operator-(const quantity<D, R1, Rep1> lhs,
+                                       const quantity<D, R2, Rep2> rhs) noexcept
+    -> _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2> {
+  using common = _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2>;
+  return common{lhs} - common{rhs};
+}
+
+/// \brief Compares two quantities of the same dimension in different units or
+/// representations in their common unit.
+template <typename D, typename R1, typename Rep1, typename R2, typename Rep2>
+  requires(!std::same_as<quantity<D, R1, Rep1>, quantity<D, R2, Rep2>>)
+[[nodiscard]] constexpr auto
+operator==(const quantity<D, R1, Rep1> lhs,
+           const quantity<D, R2, Rep2> rhs) noexcept -> bool {
+  using common = _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2>;
+  return common{lhs} == common{rhs};
+}
+
+/// \brief Orders two quantities of the same dimension in different units or
+/// representations in their common unit.
+template <typename D, typename R1, typename Rep1, typename R2, typename Rep2>
+  requires(!std::same_as<quantity<D, R1, Rep1>, quantity<D, R2, Rep2>>)
+[[nodiscard]] constexpr auto
+operator<=>(const quantity<D, R1, Rep1> lhs,
+            const quantity<D, R2, Rep2> rhs) noexcept {
+  using common = _detail::_common_quantity_t<D, R1, Rep1, R2, Rep2>;
+  return common{lhs} <=> common{rhs};
+}
+
+/// \brief Converts \c value to the quantity type \c To of the same
+/// dimension, truncating if \c To is integral.
+template <typename To, typename Dimension, typename Ratio, typename Rep>
+  requires std::same_as<
+      To, quantity<Dimension, typename To::ratio, typename To::rep>>
+[[nodiscard]] constexpr auto
+quantity_cast(const quantity<Dimension, Ratio, Rep> value) noexcept -> To {
+  return To{_detail::_quantity_convert<typename To::ratio, typename To::rep,
+                                       Ratio>(value.unwrap())};
+}
+
+////////////////////////
+// --- Type Factory ---
+////////////////////////
+
+/// \brief Tag type to prevent selection of specialized types in \c new_type.
+struct no_skills;
+
+/// \cond
+namespace _detail {
+
+template <typename Tag, typename T, typename... Args> struct _new_type_impl {
+  struct impl : public strong_type<Tag, T>,
+                public Args::template skill<impl>... {
+    using strong_type<Tag, T>::strong_type;
+
+    template <typename U>
+    using rebind = typename _new_type_impl<Tag, U, Args...>::type;
+  };
+
+  using type = impl;
+};
+
+template <typename Tag, typename T> struct _new_type_impl<Tag, T, no_skills> {
+  using type = strong_type<Tag, T>;
+};
+
+template <typename Tag, cxx_boolean T> struct _new_type_impl<Tag, T> {
+  using type = boolean_type<Tag, T>;
+};
+
+template <typename Tag, cxx_mathematical_signed_integer T>
+struct _new_type_impl<Tag, T> {
+  using type = signed_integer_type<Tag, T>;
+};
+
+template <typename Tag, cxx_mathematical_unsigned_integer T>
+struct _new_type_impl<Tag, T> {
+  using type = unsigned_integer_type<Tag, T>;
+};
+} // namespace _detail
+/// \endcond
+
+// clang-format off
+/// \brief Type factory for creating strong types with a specified set of
+/// skills.
+///
+/// The alias template \c new_type creates a strong typedef. The alias template
+/// selects the appropriate type in the library based on the provided template
+/// arguments. For example, if \c bool is passed as \c T, the resulting type is
+/// a specialization of \c boolean_type. If no specialized type is suitable, the
+/// resulting type is a specialization of \c strong_type with the specified
+/// skills. The user may prevent the selection of specialized types by passing
+/// \c no_skills as a skill or explicitly providing a list of skills.
+///
+/// Examples
+///
+/// ```cpp
+/// using strong_boolean = cina::new_type<struct Tag1, bool>; // strong_boolean is a specialization of boolean_type
+/// using strong_integer = cina::new_type<struct Tag2, int>; // strong_integer is a specialization of strong_type
+/// using no_skills = cina::new_type<struct Tag3, bool, cina::no_skills>; // no_skills is a specialization of strong_type with no skills
+/// using strong_type = cina::new_type<struct Tag4, my_type, cina::output_stream>; // strong_type is a specialization of strong_type that
+/// supports outputting to a stream
+/// ```
+///
+/// \tparam Tag A unique type used to create a distinct strong type.
+/// \tparam UnderlyingType The underlying type that the strong type wraps.
+/// \tparam Args A list of types to customize the generated type.
+// clang-format on
+template <typename Tag, typename UnderlyingType, typename... Args>
+using new_type = _detail::_new_type_impl<Tag, UnderlyingType, Args...>::type;
+
+/////////////////////////////
+// --- Strong Containers ---
+/////////////////////////////
+
+/// \cond
+namespace _detail {
+template <typename T>
+concept _index_type =
+    signed_integer<T> && !std::is_reference_v<underlying_type_t<T>>;
+
+template <typename Index>
+using _index_value_t = underlying_type_t<Index>;
+} // namespace _detail
+/// \endcond
+
+/// \brief Half-open range of consecutive strong indices.
+///
+/// The iterators hold the raw index value and construct an \c Index on
+/// dereference, so loops over an \c index_range compile to the same counted
+/// loop as a raw integer loop and can be vectorized.
+///
+/// \tparam Index The strong index type.
+template <_detail::_index_type Index> class index_range {
+  using value_type_ = _detail::_index_value_t<Index>;
+
+public:
+  class iterator {
+  public:
+    // reference is a prvalue, which the Cpp17 iterator requirements allow
+    // only for input iterators.
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Index;
+    using difference_type = std::ptrdiff_t;
+    using reference = Index;
+
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(const value_type_ value) noexcept
+        : _m_value(value) {}
+
+    [[nodiscard]] constexpr auto operator*() const noexcept -> Index {
+      return Index{_m_value};
+    }
+
+    [[nodiscard]] constexpr auto operator[](const difference_type n) const
+        noexcept -> Index {
+      return Index{static_cast<value_type_>(_m_value + n)};
+    }
+
+    constexpr auto operator++() noexcept -> iterator& {
+      ++_m_value;
+      return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> iterator {
+      iterator temp = *this;
+      ++_m_value;
+      return temp;
+    }
+
+    constexpr auto operator--() noexcept -> iterator& {
+      --_m_value;
+      return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> iterator {
+      iterator temp = *this;
+      --_m_value;
+      return temp;
+    }
+
+    constexpr auto operator+=(const difference_type n) noexcept -> iterator& {
+      _m_value = static_cast<value_type_>(_m_value + n);
+      return *this;
+    }
+
+    constexpr auto operator-=(const difference_type n) noexcept -> iterator& {
+      _m_value = static_cast<value_type_>(_m_value - n);
+      return *this;
+    }
+
+  private:
+    friend constexpr auto operator+(iterator it,
+                                    const difference_type n) noexcept
+        -> iterator {
+      return it += n;
+    }
+
+    friend constexpr auto operator+(const difference_type n,
+                                    iterator it) noexcept -> iterator {
+      return it += n;
+    }
+
+    friend constexpr auto operator-(iterator it,
+                                    const difference_type n) noexcept
+        -> iterator {
+      return it -= n;
+    }
+
+    friend constexpr auto operator-(const iterator lhs,
+                                    const iterator rhs) noexcept
+        -> difference_type {
+      return static_cast<difference_type>(lhs._m_value) - rhs._m_value;
+    }
+
+    friend constexpr auto operator==(const iterator lhs,
+                                     const iterator rhs) noexcept -> bool {
+      return lhs._m_value == rhs._m_value;
+    }
+
+    friend constexpr auto operator<=>(const iterator lhs,
+                                      const iterator rhs) noexcept {
+      return lhs._m_value <=> rhs._m_value;
+    }
+
+    value_type_ _m_value{};
+  };
+
+  constexpr index_range() noexcept = default;
+
+  /// \brief Constructs the range <tt>[first, last)</tt>.
+  constexpr index_range(const Index first, const Index last) noexcept
+      : _m_first(first.unwrap()), _m_last(last.unwrap()) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> iterator {
+    return iterator{_m_first};
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> iterator {
+    return iterator{_m_last};
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    return static_cast<std::size_t>(_m_last - _m_first);
+  }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return _m_first == _m_last;
+  }
+
+private:
+  value_type_ _m_first{};
+  value_type_ _m_last{};
+};
+
+/// \brief Vector that can only be indexed by a strong index type.
+///
+/// Class template \c strong_vector wraps a \c std::vector. Element access takes
+/// an \c Index instead of a \c std::size_t and sizes are reported in the
+/// unsigned counterpart of the index's underlying type, so a vector indexed by
+/// a 32-bit index uses 32-bit sizes. \c operator[] is unchecked unless
+/// \c NDEBUG is not defined, in which case out-of-range accesses fail an
+/// assertion. \c at() always checks and throws \c std::out_of_range.
+///
+/// \tparam Index The strong index type. It must be a \c signed_integer.
+/// \tparam T The element type.
+/// \tparam Allocator The allocator of the underlying \c std::vector.
+template <_detail::_index_type Index, typename T,
+          typename Allocator = std::allocator<T>>
+class strong_vector {
+  using vector_type = std::vector<T, Allocator>;
+
+public:
+  using index_type = Index;
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::make_unsigned_t<_detail::_index_value_t<Index>>;
+  using difference_type = typename vector_type::difference_type;
+  using reference = typename vector_type::reference;
+  using const_reference = typename vector_type::const_reference;
+  using pointer = typename vector_type::pointer;
+  using const_pointer = typename vector_type::const_pointer;
+  using iterator = typename vector_type::iterator;
+  using const_iterator = typename vector_type::const_iterator;
+  using reverse_iterator = typename vector_type::reverse_iterator;
+  using const_reverse_iterator = typename vector_type::const_reverse_iterator;
+
+  constexpr strong_vector() noexcept(noexcept(Allocator())) = default;
+
+  constexpr explicit strong_vector(const Allocator& alloc) noexcept
+      : _m_data(alloc) {}
+
+  constexpr explicit strong_vector(const size_type count,
+                                   const Allocator& alloc = Allocator())
+      : _m_data(count, alloc) {}
+
+  constexpr strong_vector(const size_type count, const T& value,
+                          const Allocator& alloc = Allocator())
+      : _m_data(count, value, alloc) {}
+
+  template <std::input_iterator InputIt>
+  constexpr strong_vector(InputIt first, InputIt last,
+                          const Allocator& alloc = Allocator())
+      : _m_data(first, last, alloc) {}
+
+  constexpr strong_vector(std::initializer_list<T> il,
+                          const Allocator& alloc = Allocator())
+      : _m_data(il, alloc) {}
+
+  [[nodiscard]] constexpr auto operator[](const Index index) noexcept
+      -> reference {
+    assert(_in_bounds(index) && "strong_vector index out of range");
+    return _m_data[static_cast<std::size_t>(index.unwrap())];
+  }
+
+  [[nodiscard]] constexpr auto operator[](const Index index) const noexcept
+      -> const_reference {
+    assert(_in_bounds(index) && "strong_vector index out of range");
+    return _m_data[static_cast<std::size_t>(index.unwrap())];
+  }
+
+  [[nodiscard]] constexpr auto at(const Index index) -> reference {
+    if (!_in_bounds(index)) {
+      throw std::out_of_range{"strong_vector index out of range"};
+    }
+    return _m_data[static_cast<std::size_t>(index.unwrap())];
+  }
+
+  [[nodiscard]] constexpr auto at(const Index index) const -> const_reference {
+    if (!_in_bounds(index)) {
+      throw std::out_of_range{"strong_vector index out of range"};
+    }
+    return _m_data[static_cast<std::size_t>(index.unwrap())];
+  }
+
+  [[nodiscard]] constexpr auto front() -> reference { return _m_data.front(); }
+  [[nodiscard]] constexpr auto front() const -> const_reference {
+    return _m_data.front();
+  }
+  [[nodiscard]] constexpr auto back() -> reference { return _m_data.back(); }
+  [[nodiscard]] constexpr auto back() const -> const_reference {
+    return _m_data.back();
+  }
+  [[nodiscard]] constexpr auto data() noexcept -> pointer {
+    return _m_data.data();
+  }
+  [[nodiscard]] constexpr auto data() const noexcept -> const_pointer {
+    return _m_data.data();
+  }
+
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+    return _m_data.begin();
+  }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+    return _m_data.begin();
+  }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator {
+    return _m_data.cbegin();
+  }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator {
+    return _m_data.end();
+  }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+    return _m_data.end();
+  }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator {
+    return _m_data.cend();
+  }
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
+    return _m_data.rbegin();
+  }
+  [[nodiscard]] constexpr auto rbegin() const noexcept
+      -> const_reverse_iterator {
+    return _m_data.rbegin();
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
+    return _m_data.rend();
+  }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return _m_data.rend();
+  }
+
+  /// \brief Returns the range of valid indices, <tt>[0, size())</tt>.
+  [[nodiscard]] constexpr auto indices() const noexcept -> index_range<Index> {
+    return index_range<Index>{Index{0}, end_index()};
+  }
+
+  /// \brief Returns the index one past the last element.
+  [[nodiscard]] constexpr auto end_index() const noexcept -> Index {
+    return Index{static_cast<_detail::_index_value_t<Index>>(_m_data.size())};
+  }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return _m_data.empty();
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+    return static_cast<size_type>(_m_data.size());
+  }
+
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type {
+    constexpr auto index_max = static_cast<std::size_t>(
+        std::numeric_limits<_detail::_index_value_t<Index>>::max());
+    const std::size_t max_size = _m_data.max_size();
+    return static_cast<size_type>(max_size < index_max ? max_size : index_max);
+  }
+
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type {
+    return static_cast<size_type>(_m_data.capacity());
+  }
+
+  constexpr auto reserve(const size_type count) -> void {
+    _m_data.reserve(count);
+  }
+
+  constexpr auto shrink_to_fit() -> void { _m_data.shrink_to_fit(); }
+
+  constexpr auto clear() noexcept -> void { _m_data.clear(); }
+
+  constexpr auto push_back(const T& value) -> void {
+    _m_data.push_back(value);
+  }
+
+  constexpr auto push_back(T&& value) -> void {
+    _m_data.push_back(std::move(value));
+  }
+
+  template <typename... Args>
+  constexpr auto emplace_back(Args&&... args) -> reference {
+    return _m_data.emplace_back(std::forward<Args>(args)...);
+  }
+
+  constexpr auto pop_back() -> void { _m_data.pop_back(); }
+
+  constexpr auto resize(const size_type count) -> void {
+    _m_data.resize(count);
+  }
+
+  constexpr auto resize(const size_type count, const T& value) -> void {
+    _m_data.resize(count, value);
+  }
+
+  constexpr auto swap(strong_vector& other) noexcept -> void {
+    _m_data.swap(other._m_data);
+  }
+
+  /// \brief Returns the wrapped \c std::vector.
+  [[nodiscard]] constexpr auto base() const noexcept -> const vector_type& {
+    return _m_data;
+  }
+
+private:
+  [[nodiscard]] constexpr auto _in_bounds(const Index index) const noexcept
+      -> bool {
+    return index.unwrap() >= 0 &&
+           static_cast<std::size_t>(index.unwrap()) < _m_data.size();
+  }
+
+  friend constexpr auto swap(strong_vector& lhs, strong_vector& rhs) noexcept
+      -> void {
+    lhs.swap(rhs);
+  }
+
+  friend constexpr auto operator==(const strong_vector& lhs,
+                                   const strong_vector& rhs) -> bool
+    requires std::equality_comparable<T>
+  {
+    return lhs._m_data == rhs._m_data;
+  }
+
+  friend constexpr auto operator<=>(const strong_vector& lhs,
+                                    const strong_vector& rhs)
+    requires std::three_way_comparable<T>
+  {
+    return lhs._m_data <=> rhs._m_data;
+  }
+
+  vector_type _m_data;
+};
+
+/// \cond
+namespace _detail {
+template <typename T, typename... Ts>
+concept _one_of = (std::same_as<T, Ts> || ...);
+
+template <typename... Ts> struct _distinct_types : std::true_type {};
+
+template <typename T, typename... Ts>
+struct _distinct_types<T, Ts...>
+    : std::bool_constant<!_one_of<T, Ts...> &&
+                         _distinct_types<Ts...>::value> {};
+
+template <typename T>
+concept _soa_field = strong_type_like<T> && !std::is_reference_v<T> &&
+                     !std::is_const_v<T> &&
+                     !std::is_reference_v<underlying_type_t<T>>;
+} // namespace _detail
+/// \endcond
+
+/// \brief Vector of records whose fields are stored in separate arrays.
+///
+/// Class template \c soa_vector stores every field type in its own
+/// \c std::vector, so a scan over one field only reads that field's array and
+/// compiles to the same loop as a scan over an array of the underlying type.
+/// Fields are accessed by type, so each field type may only appear once,
+/// which strong types make natural. \c column returns the contiguous array of
+/// one field as a \c std::span and \c operator[] returns a row as a tuple of
+/// references to its fields.
+///
+/// ```cpp
+/// using id = cina::new_type<struct IdTag, std::int32_t>;
+/// using price = cina::new_type<struct PriceTag, std::int64_t>;
+/// cina::soa_vector<id, price> orders;
+/// orders.push_back(id{1}, price{250});
+/// orders.push_back(id{2}, price{100});
+/// orders.sort_by<price>();
+/// auto [first_id, first_price] = orders[0]; // id{2}, price{100}
+/// ```
+///
+/// \tparam Fields The strong field types of a record.
+template <_detail::_soa_field... Fields>
+  requires(sizeof...(Fields) > 0 &&
+           _detail::_distinct_types<Fields...>::value)
+class soa_vector {
+public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using reference = std::tuple<Fields&...>;
+  using const_reference = std::tuple<const Fields&...>;
+
+  constexpr soa_vector() = default;
+
+  /// \brief Returns the contiguous array of \c Field.
+  template <_detail::_one_of<Fields...> Field>
+  [[nodiscard]] constexpr auto column() noexcept -> std::span<Field> {
+    return std::get<std::vector<Field>>(_m_columns);
+  }
+
+  template <_detail::_one_of<Fields...> Field>
+  [[nodiscard]] constexpr auto column() const noexcept
+      -> std::span<const Field> {
+    return std::get<std::vector<Field>>(_m_columns);
+  }
+
+  /// \brief Returns the row at \c index as a tuple of references to its
+  /// fields.
+  ///
+  /// Assigning a tuple of values to the row assigns each field.
+  [[nodiscard]] constexpr auto operator[](const size_type index) noexcept
+      -> reference {
+    assert(index < size() && "soa_vector index out of range");
+    return reference{std::get<std::vector<Fields>>(_m_columns)[index]...};
+  }
+
+  [[nodiscard]] constexpr auto operator[](const size_type index) const noexcept
+      -> const_reference {
+    assert(index < size() && "soa_vector index out of range");
+    return const_reference{std::get<std::vector<Fields>>(_m_columns)[index]...};
+  }
+
+  [[nodiscard]] constexpr auto at(const size_type index) -> reference {
+    if (index >= size()) {
+      throw std::out_of_range{"soa_vector index out of range"};
+    }
+    return (*this)[index];
+  }
+
+  [[nodiscard]] constexpr auto at(const size_type index) const
+      -> const_reference {
+    if (index >= size()) {
+      throw std::out_of_range{"soa_vector index out of range"};
+    }
+    return (*this)[index];
+  }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return size() == 0;
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+    return std::get<0>(_m_columns).size();
+  }
+
+  constexpr auto reserve(const size_type count) -> void {
+    (std::get<std::vector<Fields>>(_m_columns).reserve(count), ...);
+  }
+
+  constexpr auto clear() noexcept -> void {
+    (std::get<std::vector<Fields>>(_m_columns).clear(), ...);
+  }
+
+  /// \brief Appends a record.
+  ///
+  /// If copying a field throws, the fields already appended are removed
+  /// again, so the columns keep the same size.
+  constexpr auto push_back(const Fields&... fields) -> void {
+    const size_type old_size = size();
+    try {
+      (std::get<std::vector<Fields>>(_m_columns).push_back(fields), ...);
+    } catch (...) {
+      truncate(old_size);
+      throw;
+    }
+  }
+
+  constexpr auto push_back(const value_type& record) -> void {
+    std::apply([this](const Fields&... fields) { push_back(fields...); },
+               record);
+  }
+
+  constexpr auto pop_back() -> void {
+    assert(!empty() && "pop_back on empty soa_vector");
+    (std::get<std::vector<Fields>>(_m_columns).pop_back(), ...);
+  }
+
+  /// \brief Removes the record at \c index, keeping the order of the others.
+  constexpr auto erase(const size_type index) -> void {
+    assert(index < size() && "soa_vector index out of range");
+    const auto offset = static_cast<std::ptrdiff_t>(index);
+    (std::get<std::vector<Fields>>(_m_columns)
+         .erase(std::get<std::vector<Fields>>(_m_columns).begin() + offset),
+     ...);
+  }
+
+  /// \brief Stably sorts the records by their \c Field.
+  ///
+  /// The permutation is computed from the \c Field column alone and then
+  /// applied to every column, so records with equal keys keep their order
+  /// and sorting by several fields in turn yields a lexicographic order.
+  template <_detail::_one_of<Fields...> Field, typename Compare = std::less<>>
+  constexpr auto sort_by(Compare comp = Compare{}) -> void {
+    const std::span<const Field> keys = column<Field>();
+    std::vector<size_type> order(size());
+    for (size_type i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](const size_type lhs, const size_type rhs) {
+                       return comp(keys[lhs], keys[rhs]);
+                     });
+    (permute(std::get<std::vector<Fields>>(_m_columns), order), ...);
+  }
+
+  constexpr auto swap(soa_vector& other) noexcept -> void {
+    _m_columns.swap(other._m_columns);
+  }
+
+private:
+  template <typename Field>
+  static constexpr auto permute(std::vector<Field>& values,
+                                const std::vector<size_type>& order) -> void {
+    std::vector<Field> permuted;
+    permuted.reserve(values.size());
+    for (const size_type index : order) {
+      permuted.push_back(std::move(values[index]));
+    }
+    values.swap(permuted);
+  }
+
+  constexpr auto truncate(const size_type count) noexcept -> void {
+    ((std::get<std::vector<Fields>>(_m_columns).size() > count
+          ? std::get<std::vector<Fields>>(_m_columns).pop_back()
+          : void()),
+     ...);
+  }
+
+  friend constexpr auto swap(soa_vector& lhs, soa_vector& rhs) noexcept
+      -> void {
+    lhs.swap(rhs);
+  }
+
+  friend constexpr auto operator==(const soa_vector& lhs,
+                                   const soa_vector& rhs) -> bool
+    requires(std::equality_comparable<Fields> && ...)
+  {
+    return lhs._m_columns == rhs._m_columns;
+  }
+
+  std::tuple<std::vector<Fields>...> _m_columns;
+};
+
+/// \brief A key and its value in a \c static_map.
+///
+/// \tparam Key The key type.
+/// \tparam Value The mapped type.
+template <typename Key, typename Value> struct map_entry {
+  Key key;
+  Value value;
+};
+
+/// \cond
+namespace _detail {
+template <typename Key>
+concept _static_map_key =
+    strong_type_like<Key> && !std::is_reference_v<underlying_type_t<Key>> &&
+    _hashable_bits<std::remove_cvref_t<underlying_type_t<Key>>>;
+
+// Kept at 64 bits on every target: truncating to std::size_t would make the
+// hash no longer a bijection of the key.
+template <typename Key>
+constexpr auto _static_map_hash(const Key key) noexcept -> std::uint64_t {
+  return splitmix64{}(_hash_bits(key.unwrap()));
+}
+} // namespace _detail
+/// \endcond
+
+/// \brief Immutable map from strong keys to values whose table is built at
+/// compile time.
+///
+/// The entries are non-type template arguments, so both \c Key and \c Value
+/// must be structural types. Strong types are structural if their underlying
+/// type is. The keys are placed with a minimal perfect hash, and a
+/// lookup hashes the key, reads one slot and compares one key without any
+/// branches. Duplicate keys are a compile-time error.
+///
+/// ```cpp
+/// using routes = cina::static_map<
+///     route_id, handler_id, cina::map_entry{route_id{80}, handler_id{1}},
+///     cina::map_entry{route_id{443}, handler_id{2}}>;
+/// static_assert(routes::value_or(route_id{443}, handler_id{0}) ==
+///               handler_id{2});
+/// ```
+///
+/// \tparam Key The strong key type, whose underlying type is an integer or an
+/// enumeration.
+/// \tparam Value The mapped type.
+/// \tparam Entries The entries of the map.
+template <_detail::_static_map_key Key, typename Value,
+          map_entry<Key, Value>... Entries>
+  requires(sizeof...(Entries) > 0)
+class static_map {
+  static constexpr std::size_t entry_count = sizeof...(Entries);
+
+  static constexpr std::array<std::uint64_t, entry_count> hashes{
+      _detail::_static_map_hash(Entries.key)...};
+
+  static constexpr auto distinct() noexcept -> bool {
+    for (std::size_t i = 0; i < entry_count; ++i) {
+      for (std::size_t j = i + 1; j < entry_count; ++j) {
+        if (hashes[i] == hashes[j]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  static_assert(distinct(), "static_map keys must be distinct");
+
+  static constexpr _detail::_hash_displace<entry_count> index{hashes};
+  static_assert(index.complete);
+
+  static constexpr std::array<Key, entry_count> keys_{Entries.key...};
+  static constexpr std::array<Value, entry_count> values_{Entries.value...};
+
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+
+  [[nodiscard]] static constexpr auto size() noexcept -> std::size_t {
+    return entry_count;
+  }
+
+  /// \brief Returns the keys in the order of the template arguments.
+  [[nodiscard]] static constexpr auto keys() noexcept -> std::span<const Key> {
+    return keys_;
+  }
+
+  /// \brief Returns the values in the order of the template arguments.
+  [[nodiscard]] static constexpr auto values() noexcept
+      -> std::span<const Value> {
+    return values_;
+  }
+
+  /// \brief Returns a pointer to the value of \c key, or a null pointer if
+  /// the map does not contain \c key.
+  [[nodiscard]] static constexpr auto find(const Key key) noexcept
+      -> const Value* {
+    const std::size_t position = lookup(key);
+    return position < entry_count ? &values_[position] : nullptr;
+  }
+
+  /// \brief Returns the value of \c key, or \c fallback if the map does not
+  /// contain \c key.
+  [[nodiscard]] static constexpr auto value_or(const Key key,
+                                               const Value fallback) noexcept
+      -> Value {
+    const std::size_t position = lookup(key);
+    return position < entry_count ? values_[position] : fallback;
+  }
+
+  [[nodiscard]] static constexpr auto contains(const Key key) noexcept
+      -> bool {
+    return lookup(key) < entry_count;
+  }
+
+private:
+  // Returns the position of key, or entry_count. The hash is a bijection of
+  // the key, so comparing hashes compares keys. An empty slot is read as
+  // position zero, whose key would have been found in its own slot.
+  static constexpr auto lookup(const Key key) noexcept -> std::size_t {
+    const std::uint64_t hash = _detail::_static_map_hash(key);
+    const std::uint16_t entry = index.entry(hash);
+    const std::size_t position = entry == 0 ? 0 : entry - 1U;
+    return hashes[position] == hash ? position : entry_count;
+  }
+};
+
+//////////////////////////////
+// --- Views of Sequences ---
+//////////////////////////////
+
+/// \cond
+namespace _detail {
+// A strong type is layout-compatible with its underlying type if an array of
+// one can be accessed as an array of the other. The underlying value is the
+// first member of a standard-layout class, so the two are
+// pointer-interconvertible, and the same size and alignment leave no padding
+// between the elements.
+template <typename T>
+concept _layout_compatible =
+    strong_type_like<T> && !std::is_reference_v<underlying_type_t<T>> &&
+    std::is_standard_layout_v<T> &&
+    sizeof(T) == sizeof(underlying_type_t<T>) &&
+    alignof(T) == alignof(underlying_type_t<T>);
+
+template <typename Tag, typename Enum>
+auto _as_enumeration_type(enumeration<Tag, Enum>) -> void;
+
+template <typename Tag, typename Enum>
+auto _as_flags_type(flags<Tag, Enum>) -> void;
+
+// Types whose constructors reject or change some underlying values. Viewing
+// arbitrary underlying values as these types would bypass the check.
+template <typename T>
+concept _validated_type =
+    range_constrained_integer<T> || modular_type<T> ||
+    requires { _as_enumeration_type(std::declval<T>()); } ||
+    requires { _as_flags_type(std::declval<T>()); };
+
+template <typename From, typename To>
+using _copy_const_t =
+    std::conditional_t<std::is_const_v<From>, std::add_const_t<To>, To>;
+
+template <typename R>
+using _span_of_t = decltype(std::span(std::declval<R>()));
+
+template <typename R>
+using _span_element_t = typename _span_of_t<R>::element_type;
+
+struct _unwrap_fn {
+  template <typename T>
+    requires strong_type_like<std::remove_cvref_t<T>>
+  constexpr auto operator()(T&& value) const noexcept -> decltype(auto) {
+    // Elements that are references yield references to their underlying
+    // values, which are const for validated types so that no unchecked value
+    // can be written. Prvalue elements yield a copy, which would otherwise
+    // dangle.
+    using strong = std::remove_cvref_t<T>;
+    if constexpr (std::is_lvalue_reference_v<T> && _validated_type<strong>) {
+      return static_cast<const underlying_type_t<strong>&>(value.unwrap());
+    } else if constexpr (std::is_lvalue_reference_v<T>) {
+      return (value.unwrap());
+    } else {
+      return std::remove_cvref_t<underlying_type_t<std::remove_cvref_t<T>>>(
+          std::move(value).unwrap());
+    }
+  }
+};
+
+template <typename Strong> struct _wrap_fn {
+  template <typename U>
+    requires std::constructible_from<Strong, U>
+  constexpr auto operator()(U&& value) const -> Strong {
+    return Strong{std::forward<U>(value)};
+  }
+};
+} // namespace _detail
+/// \endcond
+
+/// \namespace cina::views
+/// \brief Range adaptors for sequences of strong types.
+namespace views {
+
+/// \brief Range adaptor that views a sequence of strong values as their
+/// underlying values.
+///
+/// The elements of the view are references to the underlying values, so
+/// assigning through them modifies the original sequence. Nothing is copied.
+/// For types that check their values, such as \c range_integer, the
+/// references are const.
+///
+/// ```cpp
+/// std::vector<meters> lengths = ...;
+/// const double total = std::ranges::fold_left(
+///     lengths | cina::views::unwrap, 0.0, std::plus<>{});
+/// ```
+inline constexpr auto unwrap = std::views::transform(_detail::_unwrap_fn{});
+
+/// \brief Range adaptor that views a sequence of values as strong values of
+/// type \c Strong.
+///
+/// Each element is constructed from the corresponding value when it is read,
+/// so types that check their values, such as \c range_integer, throw
+/// \c constraint_error for values outside their range.
+///
+/// \tparam Strong The strong type of the elements.
+template <strong_type_like Strong>
+inline constexpr auto wrap = std::views::transform(_detail::_wrap_fn<Strong>{});
+
+} // namespace views
+
+/// \brief Returns a span of the underlying values of a contiguous sequence of
+/// strong values.
+///
+/// The span refers to the same memory as \c range and has the same extent,
+/// so it can be passed to functions taking spans of the underlying type
+/// without copying. The strong type must be layout-compatible with its
+/// underlying type, which is checked at compile time. For types that check
+/// their values, such as \c range_integer and \c enumeration, the span is
+/// read-only, as writing through it would bypass the check.
+///
+/// ```cpp
+/// std::vector<sample> samples = ...;
+/// std::span<std::int16_t> raw = cina::as_underlying_span(samples);
+/// ```
+///
+/// \param range A contiguous range that a \c std::span can refer to.
+template <typename R>
+  requires _detail::_layout_compatible<
+      std::remove_cv_t<_detail::_span_element_t<R>>>
+[[nodiscard]] auto as_underlying_span(R&& range) noexcept {
+  const auto strong = std::span(std::forward<R>(range));
+  using strong_element = typename decltype(strong)::element_type;
+  using element = std::conditional_t<
+      _detail::_validated_type<std::remove_cv_t<strong_element>>,
+      const underlying_type_t<std::remove_cv_t<strong_element>>,
+      _detail::_copy_const_t<
+          strong_element, underlying_type_t<std::remove_cv_t<strong_element>>>>;
+  return std::span<element, decltype(strong)::extent>(
+      reinterpret_cast<element*>(strong.data()), strong.size());
+}
+
+/// \brief Returns a span of the values of a contiguous sequence viewed as
+/// values of the strong type \c Strong.
+///
+/// The inverse of \c as_underlying_span. The elements of \c range must have
+/// the underlying type of \c Strong. Types whose constructors check their
+/// values, such as \c range_integer and \c enumeration, are rejected at
+/// compile time, as the values in \c range have not been checked.
+///
+/// \tparam Strong The strong type of the elements.
+/// \param range A contiguous range that a \c std::span can refer to.
+template <strong_type_like Strong, typename R>
+  requires _detail::_layout_compatible<Strong> &&
+           (!_detail::_validated_type<Strong>) &&
+           std::same_as<std::remove_cv_t<_detail::_span_element_t<R>>,
+                        std::remove_cv_t<underlying_type_t<Strong>>>
+[[nodiscard]] auto as_strong_span(R&& range) noexcept {
+  const auto underlying = std::span(std::forward<R>(range));
+  using element = _detail::_copy_const_t<
+      typename decltype(underlying)::element_type, Strong>;
+  return std::span<element, decltype(underlying)::extent>(
+      reinterpret_cast<element*>(underlying.data()), underlying.size());
+}
+
+//////////////////////
+// --- Atomic Types ---
+//////////////////////
+
+/// \cond
+namespace _detail {
+template <typename T>
+using _atomic_value_t = std::remove_cv_t<underlying_type_t<T>>;
+
+template <typename T>
+concept _atomic_strong_type =
+    strong_type_like<T> && !std::is_reference_v<underlying_type_t<T>> &&
+    std::is_trivially_copyable_v<T> &&
+    sizeof(T) == sizeof(_atomic_value_t<T>) &&
+    std::atomic<_atomic_value_t<T>>::is_always_lock_free;
+
+template <typename T, typename Skill>
+concept _has_skill = std::derived_from<T, typename Skill::template skill<T>>;
+
+// The operator of these skills wraps around like the read-modify-write
+// instructions, so fetch_add and friends can use them directly. Other
+// operators that return T are applied in a compare-and-swap loop.
+template <typename T>
+concept _native_fetch_add =
+    (std::integral<_atomic_value_t<T>> &&
+     (_has_skill<T, addition> || _has_skill<T, addition::with<wrap>>)) ||
+    (std::floating_point<_atomic_value_t<T>> && _has_skill<T, addition>);
+
+template <typename T>
+concept _native_fetch_sub =
+    (std::integral<_atomic_value_t<T>> &&
+     (_has_skill<T, subtraction> || _has_skill<T, subtraction::with<wrap>>)) ||
+    (std::floating_point<_atomic_value_t<T>> && _has_skill<T, subtraction>);
+
+template <typename T>
+concept _native_fetch_bitwise =
+    std::integral<_atomic_value_t<T>> && _has_skill<T, bitwise>;
+
+// The operations shared by atomic and atomic_ref. Derived provides
+// storage(), which returns the std::atomic or std::atomic_ref of the
+// underlying value.
+template <typename Derived, typename T> class _atomic_operations {
+  using value_type_ = _atomic_value_t<T>;
+
+public:
+  using value_type = T;
+
+  static constexpr bool is_always_lock_free = true;
+
+  [[nodiscard]] auto is_lock_free() const noexcept -> bool {
+    return storage().is_lock_free();
+  }
+
+  auto store(const T desired,
+             const std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> void {
+    storage().store(desired.unwrap(), order);
+  }
+
+  [[nodiscard]] auto
+  load(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+      -> T {
+    return wrap_value(storage().load(order));
+  }
+
+  auto
+  exchange(const T desired,
+           const std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> T {
+    return wrap_value(storage().exchange(desired.unwrap(), order));
+  }
+
+  /// \brief Replaces the value with \c desired if it equals \c expected,
+  /// otherwise loads it into \c expected.
+  ///
+  /// Values are compared by their object representation, so the operation
+  /// is only provided for types with an equality operator.
+  auto compare_exchange_weak(T& expected, const T desired,
+                             const std::memory_order success,
+                             const std::memory_order failure) noexcept -> bool
+    requires std::equality_comparable<T>
+  {
+    return storage().compare_exchange_weak(expected.unwrap(),
+                                           desired.unwrap(), success, failure);
+  }
+
+  auto compare_exchange_weak(
+      T& expected, const T desired,
+      const std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> bool
+    requires std::equality_comparable<T>
+  {
+    return storage().compare_exchange_weak(expected.unwrap(),
+                                           desired.unwrap(), order);
+  }
+
+  auto compare_exchange_strong(T& expected, const T desired,
+                               const std::memory_order success,
+                               const std::memory_order failure) noexcept
+      -> bool
+    requires std::equality_comparable<T>
+  {
+    return storage().compare_exchange_strong(
+        expected.unwrap(), desired.unwrap(), success, failure);
+  }
+
+  auto compare_exchange_strong(
+      T& expected, const T desired,
+      const std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> bool
+    requires std::equality_comparable<T>
+  {
+    return storage().compare_exchange_strong(expected.unwrap(),
+                                             desired.unwrap(), order);
+  }
+
+  /// \brief Atomically replaces the value with the result of <tt>+</tt> and
+  /// returns the previous value.
+  ///
+  /// Provided if \c T has the \c addition skill, which wraps around like the
+  /// hardware instruction, or an operator <tt>+</tt> returning \c T, such as
+  /// \c addition::with<saturate>, which is applied in a compare-and-swap
+  /// loop.
+  auto fetch_add(const T arg,
+                 const std::memory_order order = std::memory_order_seq_cst)
+      -> T
+    requires _native_fetch_add<T> ||
+             requires(const T value) {
+               { value + value } -> std::same_as<T>;
+             }
+  {
+    if constexpr (_native_fetch_add<T>) {
+      return wrap_value(storage().fetch_add(arg.unwrap(), order));
+    } else {
+      return update([arg](const T value) { return value + arg; }, order);
+    }
+  }
+
+  /// \brief Atomically replaces the value with the result of <tt>-</tt> and
+  /// returns the previous value.
+  ///
+  /// See \c fetch_add for the skills this requires.
+  auto fetch_sub(const T arg,
+                 const std::memory_order order = std::memory_order_seq_cst)
+      -> T
+    requires _native_fetch_sub<T> ||
+             requires(const T value) {
+               { value - value } -> std::same_as<T>;
+             }
+  {
+    if constexpr (_native_fetch_sub<T>) {
+      return wrap_value(storage().fetch_sub(arg.unwrap(), order));
+    } else {
+      return update([arg](const T value) { return value - arg; }, order);
+    }
+  }
+
+  auto fetch_and(const T arg,
+                 const std::memory_order order = std::memory_order_seq_cst)
+      -> T
+    requires _native_fetch_bitwise<T> ||
+             requires(const T value) {
+               { value & value } -> std::same_as<T>;
+             }
+  {
+    if constexpr (_native_fetch_bitwise<T>) {
+      return wrap_value(storage().fetch_and(arg.unwrap(), order));
+    } else {
+      return update([arg](const T value) { return value & arg; }, order);
+    }
+  }
+
+  auto fetch_or(const T arg,
+                const std::memory_order order = std::memory_order_seq_cst)
+      -> T
+    requires _native_fetch_bitwise<T> ||
+             requires(const T value) {
+               { value | value } -> std::same_as<T>;
+             }
+  {
+    if constexpr (_native_fetch_bitwise<T>) {
+      return wrap_value(storage().fetch_or(arg.unwrap(), order));
+    } else {
+      return update([arg](const T value) { return value | arg; }, order);
+    }
+  }
+
+  auto fetch_xor(const T arg,
+                 const std::memory_order order = std::memory_order_seq_cst)
+      -> T
+    requires _native_fetch_bitwise<T> ||
+             requires(const T value) {
+               { value ^ value } -> std::same_as<T>;
+             }
+  {
+    if constexpr (_native_fetch_bitwise<T>) {
+      return wrap_value(storage().fetch_xor(arg.unwrap(), order));
+    } else {
+      return update([arg](const T value) { return value ^ arg; }, order);
+    }
+  }
+
+  auto wait(const T old, const std::memory_order order =
+                               std::memory_order_seq_cst) const noexcept
+      -> void {
+    storage().wait(old.unwrap(), order);
+  }
+
+  auto notify_one() noexcept -> void { storage().notify_one(); }
+
+  auto notify_all() noexcept -> void { storage().notify_all(); }
+
+private:
+  // The object representations of T and its underlying type are the same,
+  // and bypassing the constructors skips the range checks of types such as
+  // range_integer, whose values were checked when they were stored.
+  static auto wrap_value(const value_type_ value) noexcept -> T {
+    return std::bit_cast<T>(value);
+  }
+
+  template <typename Operation>
+  auto update(const Operation operation, const std::memory_order order) -> T {
+    value_type_ expected = storage().load(std::memory_order_relaxed);
+    while (!storage().compare_exchange_weak(
+        expected, operation(wrap_value(expected)).unwrap(), order,
+        std::memory_order_relaxed)) {
+    }
+    return wrap_value(expected);
+  }
+
+  auto storage() noexcept -> decltype(auto) {
+    return static_cast<Derived&>(*this).storage();
+  }
+
+  auto storage() const noexcept -> decltype(auto) {
+    return static_cast<const Derived&>(*this).storage();
+  }
+};
+} // namespace _detail
+/// \endcond
+
+/// \brief Atomic object holding a strong type.
+///
+/// \c atomic<T> has the same size and representation as
+/// \c std::atomic of the underlying type of \c T and is only available if
+/// that atomic is always lock-free. \c fetch_add, \c fetch_sub,
+/// \c fetch_and, \c fetch_or and \c fetch_xor are provided if \c T has the
+/// corresponding skills, and \c compare_exchange_weak and
+/// \c compare_exchange_strong if \c T is equality comparable.
+///
+/// ```cpp
+/// using sequence = cina::new_type<struct SequenceTag, std::int64_t>;
+/// cina::atomic<sequence> next{sequence{0}};
+/// const sequence mine = next.fetch_add(sequence{1});
+/// ```
+///
+/// \tparam T The strong type.
+template <_detail::_atomic_strong_type T>
+class atomic : public _detail::_atomic_operations<atomic<T>, T> {
+  using value_type_ = _detail::_atomic_value_t<T>;
+  friend class _detail::_atomic_operations<atomic<T>, T>;
+
+public:
+  constexpr atomic() noexcept = default;
+
+  constexpr explicit atomic(const T desired) noexcept
+      : _m_atomic(desired.unwrap()) {}
+
+  atomic(const atomic&) = delete;
+  auto operator=(const atomic&) -> atomic& = delete;
+
+private:
+  auto storage() noexcept -> std::atomic<value_type_>& { return _m_atomic; }
+
+  auto storage() const noexcept -> const std::atomic<value_type_>& {
+    return _m_atomic;
+  }
+
+  std::atomic<value_type_> _m_atomic;
+};
+
+/// \brief Reference to a strong value that is accessed atomically.
+///
+/// \c atomic_ref<T> is the counterpart of \c atomic for strong values stored
+/// in ordinary objects and arrays. As with \c std::atomic_ref, the referenced
+/// object must be aligned to \c required_alignment and must only be accessed
+/// through \c atomic_ref while any \c atomic_ref to it exists.
+///
+/// \tparam T The strong type.
+template <_detail::_atomic_strong_type T>
+class atomic_ref : public _detail::_atomic_operations<atomic_ref<T>, T> {
+  using value_type_ = _detail::_atomic_value_t<T>;
+  friend class _detail::_atomic_operations<atomic_ref<T>, T>;
+
+public:
+  static constexpr std::size_t required_alignment =
+      std::atomic_ref<value_type_>::required_alignment;
+
+  explicit atomic_ref(T& object) noexcept : _m_atomic(object.unwrap()) {}
+
+  atomic_ref(const atomic_ref&) noexcept = default;
+  auto operator=(const atomic_ref&) -> atomic_ref& = delete;
+
+private:
+  auto storage() const noexcept -> const std::atomic_ref<value_type_>& {
+    return _m_atomic;
+  }
+
+  std::atomic_ref<value_type_> _m_atomic;
+};
+
+/// \brief The size of the cache lines that \c cache_aligned pads to.
+///
+/// Defaults to 64 and can be changed by defining \c CINA_CACHE_LINE_SIZE,
+/// consistently across all translation units.
+inline constexpr std::size_t cache_line_size = CINA_CACHE_LINE_SIZE;
+
+/// \brief A value aligned to and padded to a multiple of \c cache_line_size.
+///
+/// Adjacent \c cache_aligned objects never share a cache line, so threads
+/// updating different ones do not invalidate each other's caches.
+///
+/// \tparam T The type of the value.
+template <typename T> struct alignas(cache_line_size) cache_aligned {
+  T value;
+};
+
+/// \cond
+namespace _detail {
+template <typename T>
+concept _shardable_counter =
+    _atomic_strong_type<T> && std::integral<_atomic_value_t<T>> &&
+    _native_fetch_add<T>;
+
+// Threads are assigned shards round robin in the order they first touch any
+// sharded_counter.
+inline auto _thread_shard() noexcept -> std::size_t {
+  static std::atomic<std::size_t> next_shard{0};
+  thread_local const std::size_t shard =
+      next_shard.fetch_add(1, std::memory_order_relaxed);
+  return shard;
+}
+} // namespace _detail
+/// \endcond
+
+/// \brief Counter that is split into cache-line-sized shards to scale under
+/// contention.
+///
+/// Each thread adds to its own shard with a relaxed atomic addition, so
+/// concurrent increments do not contend on one cache line unless more than
+/// \c ShardCount threads are updating the counter. \c load adds up the
+/// shards on demand. It is not a snapshot of a single point in time if the
+/// counter is updated concurrently, but it observes every update that
+/// happens before it.
+///
+/// \c T must be an integer type whose \c addition skill wraps around, as the
+/// sum of the shards is only the sum of the updates under that arithmetic.
+///
+/// ```cpp
+/// using requests = cina::new_type<struct RequestsTag, std::int64_t>;
+/// cina::sharded_counter<requests> served;
+/// served.increment(); // on many threads
+/// const requests total = served.load();
+/// ```
+///
+/// \tparam T The strong integer type.
+/// \tparam ShardCount The number of shards.
+template <_detail::_shardable_counter T, std::size_t ShardCount = 32>
+  requires(ShardCount > 0)
+class sharded_counter {
+  using value_type_ = _detail::_atomic_value_t<T>;
+
+public:
+  using value_type = T;
+
+  static constexpr std::size_t shard_count = ShardCount;
+
+  constexpr sharded_counter() noexcept = default;
+
+  sharded_counter(const sharded_counter&) = delete;
+  auto operator=(const sharded_counter&) -> sharded_counter& = delete;
+
+  /// \brief Adds \c delta to the shard of the calling thread.
+  auto add(const T delta) noexcept -> void {
+    shard().fetch_add(delta.unwrap(), std::memory_order_relaxed);
+  }
+
+  /// \brief Subtracts \c delta from the shard of the calling thread.
+  auto subtract(const T delta) noexcept -> void {
+    shard().fetch_sub(delta.unwrap(), std::memory_order_relaxed);
+  }
+
+  auto increment() noexcept -> void { add(T{value_type_{1}}); }
+
+  auto decrement() noexcept -> void { subtract(T{value_type_{1}}); }
+
+  /// \brief Returns the sum of all shards.
+  [[nodiscard]] auto load() const noexcept -> T {
+    using sum_type = std::make_unsigned_t<value_type_>;
+    sum_type sum = 0;
+    for (const auto& shard : _m_shards) {
+      sum += static_cast<sum_type>(
+          shard.value.load(std::memory_order_relaxed));
+    }
+    return T{static_cast<value_type_>(sum)};
+  }
+
+  /// \brief Resets all shards to zero.
+  ///
+  /// Updates that race with \c reset may or may not be kept.
+  auto reset() noexcept -> void {
+    for (auto& shard : _m_shards) {
+      shard.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  auto shard() noexcept -> std::atomic<value_type_>& {
+    return _m_shards[_detail::_thread_shard() % ShardCount].value;
+  }
+
+  std::array<cache_aligned<std::atomic<value_type_>>, ShardCount> _m_shards{};
+};
+
+} // namespace cina
+
+//////////////////////////////////////////
+// --- Standard Libary Specializations ---
+//////////////////////////////////////////
+
+template <cina::strong_type_like T> struct std::hash<T> {
+  auto operator()(const T& value) const
+      noexcept(noexcept(std::hash<cina::underlying_type_t<T>>{}(
+          value.unwrap()))) -> std::size_t {
+    return std::hash<cina::underlying_type_t<T>>{}(value.unwrap());
+  }
+};
+
+/// \brief Specialization of \c std::hash for strong types with the \c hashing
+/// skill.
+template <cina::strong_type_like T>
+  requires requires { typename T::hash_mixer; }
+struct std::hash<T> {
+  constexpr auto operator()(const T& value) const noexcept -> std::size_t {
+    return cina::_detail::_mix<typename T::hash_mixer>(value.unwrap());
+  }
+};
+
+/// \brief Specialization of \c std::formatter for decimal types.
+///
+/// Formats the text written by \c to_chars, so a format specification such
+/// as <tt>{:>12}</tt> applies to the whole number.
+template <typename Tag, int Digits, int Scale>
+struct std::formatter<cina::decimal<Tag, Digits, Scale>>
+    : std::formatter<std::string_view> {
+  template <typename FormatContext>
+  auto format(const cina::decimal<Tag, Digits, Scale>& value,
+              FormatContext& ctx) const {
+    using decimal_type = cina::decimal<Tag, Digits, Scale>;
+    char buffer[decimal_type::max_chars];
+    const auto result =
+        to_chars(buffer, buffer + decimal_type::max_chars, value);
+    return std::formatter<std::string_view>::format(
+        std::string_view(buffer, result.ptr), ctx);
+  }
+};
+
+/// \brief Specialization of \c std::formatter for enumeration types.
+///
+/// Formats the name of the enumerator.
+template <typename Tag, typename Enum>
+struct std::formatter<cina::enumeration<Tag, Enum>>
+    : std::formatter<std::string_view> {
+  template <typename FormatContext>
+  auto format(const cina::enumeration<Tag, Enum>& value,
+              FormatContext& ctx) const {
+    return std::formatter<std::string_view>::format(value.name(), ctx);
+  }
+};
+
+/// \brief Specialization of \c std::formatter for strong types.
+///
+/// Delegates parsing and formatting to the formatter of the underlying type,
+/// so every format specification accepted by the underlying type (e.g.
+/// <tt>{:08x}</tt> or <tt>{:.3f}</tt>) is accepted here and the output is
+/// identical to formatting the unwrapped value. Output is written directly to
+/// the format context without intermediate buffers.
 template <cina::strong_type_like T>
   requires std::formattable<cina::underlying_type_t<T>, char>
-struct std::formatter<T> : std::formatter<std::string_view> {
-  auto format(const T& value, format_context& ctx) const {
-    std::string out;
-    std::format_to(std::back_inserter(out), "{}", value.unwrap());
-    return std::formatter<std::string_view>::format(out, ctx);
+struct std::formatter<T>
+    : std::formatter<std::remove_cvref_t<cina::underlying_type_t<T>>> {
+  template <typename FormatContext>
+  auto format(const T& value, FormatContext& ctx) const {
+    return std::formatter<std::remove_cvref_t<cina::underlying_type_t<T>>>::
+        format(value.unwrap(), ctx);
   }
 };
 
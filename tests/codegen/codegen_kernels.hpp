@@ -0,0 +1,97 @@
+/// \file codegen_kernels.hpp
+/// \brief Kernels compiled once with a raw integer and once with a strong
+/// integer to check both produce the same machine code.
+///
+/// The including translation unit must declare \c cina_codegen::value_type
+/// before including this file. Every kernel has C linkage so that both object
+/// files export identical symbol names.
+
+#ifndef CINA_CODEGEN_KERNELS_HPP
+#define CINA_CODEGEN_KERNELS_HPP
+
+#include <cstddef>    // size_t
+#include <functional> // hash
+
+using cina_codegen::value_type;
+
+extern "C" {
+
+auto kernel_add(const value_type* lhs, const value_type* rhs, value_type* out)
+    -> void {
+  *out = *lhs + *rhs;
+}
+
+auto kernel_subtract(const value_type* lhs, const value_type* rhs,
+                     value_type* out) -> void {
+  *out = *lhs - *rhs;
+}
+
+auto kernel_multiply(const value_type* lhs, const value_type* rhs,
+                     value_type* out) -> void {
+  *out = *lhs * *rhs;
+}
+
+auto kernel_divide(const value_type* lhs, const value_type* rhs,
+                   value_type* out) -> void {
+  *out = *lhs / *rhs;
+}
+
+auto kernel_modulo(const value_type* lhs, const value_type* rhs,
+                   value_type* out) -> void {
+  *out = *lhs % *rhs;
+}
+
+auto kernel_negate(const value_type* value, value_type* out) -> void {
+  *out = -*value;
+}
+
+auto kernel_compound(const value_type* value, const value_type* rhs,
+                     value_type* out) -> void {
+  value_type result = *value;
+  result += *rhs;
+  result *= *rhs;
+  result -= *rhs;
+  ++result;
+  --result;
+  *out = result;
+}
+
+auto kernel_equal(const value_type* lhs, const value_type* rhs) -> bool {
+  return *lhs == *rhs;
+}
+
+auto kernel_less(const value_type* lhs, const value_type* rhs) -> bool {
+  return *lhs < *rhs;
+}
+
+auto kernel_hash(const value_type* value) -> std::size_t {
+  return std::hash<value_type>{}(*value);
+}
+
+auto kernel_sum(const value_type* values, const std::size_t size,
+                value_type* out) -> void {
+  value_type sum{0};
+  for (std::size_t i = 0; i < size; ++i) {
+    sum += values[i];
+  }
+  *out = sum;
+}
+
+auto kernel_axpy(const value_type* a, const value_type* x, value_type* y,
+                 const std::size_t size) -> void {
+  for (std::size_t i = 0; i < size; ++i) {
+    y[i] = *a * x[i] + y[i];
+  }
+}
+
+auto kernel_count_less(const value_type* values, const value_type* pivot,
+                       const std::size_t size) -> std::size_t {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    count += values[i] < *pivot ? 1 : 0;
+  }
+  return count;
+}
+}
+
+#endif
\ No newline at end of file
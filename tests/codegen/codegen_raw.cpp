@@ -0,0 +1,5 @@
+namespace cina_codegen {
+using value_type = int;
+} // namespace cina_codegen
+
+#include "codegen_kernels.hpp"
\ No newline at end of file
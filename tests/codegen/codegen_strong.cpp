@@ -0,0 +1,7 @@
+#include <cina.hpp>
+
+namespace cina_codegen {
+using value_type = cina::new_type<struct CodegenTag, int>;
+} // namespace cina_codegen
+
+#include "codegen_kernels.hpp"
\ No newline at end of file
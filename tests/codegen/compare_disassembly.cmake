@@ -0,0 +1,87 @@
+# Compares the disassembly of every kernel_* function in RAW_OBJECT against the
+# function of the same name in STRONG_OBJECT and fails if any instruction
+# stream differs.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DRAW_OBJECT=<obj> -DSTRONG_OBJECT=<obj>
+#              -P compare_disassembly.cmake
+
+cmake_minimum_required(VERSION 3.25)
+
+foreach(var OBJDUMP RAW_OBJECT STRONG_OBJECT)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} must be defined")
+    endif()
+endforeach()
+
+# Disassembles `object` and stores the names of the kernels found in
+# `${prefix}_kernels` and the normalized instructions of each kernel in
+# `${prefix}_<kernel>`.
+function(disassemble object prefix)
+    execute_process(
+        COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+        OUTPUT_VARIABLE disassembly
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+    endif()
+
+    string(REPLACE ";" "<semicolon>" disassembly "${disassembly}")
+    string(REPLACE "\n" ";" lines "${disassembly}")
+
+    set(kernels)
+    set(current)
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^[0-9a-f]+ <(kernel_[A-Za-z0-9_]+)>:$")
+            set(current ${CMAKE_MATCH_1})
+            list(APPEND kernels ${current})
+            set(${prefix}_${current})
+        elseif(line MATCHES "^[0-9a-f]+ <.*>:$" OR line MATCHES "^Disassembly")
+            set(current)
+        elseif(current AND line MATCHES "^ +[0-9a-f]+:\t(.*)$")
+            set(instruction "${CMAKE_MATCH_1}")
+            # Branch targets and RIP-relative comments embed addresses.
+            string(REGEX REPLACE "[0-9a-f]+ <" "<" instruction "${instruction}")
+            string(REGEX REPLACE "[ \t]*#.*$" "" instruction "${instruction}")
+            string(STRIP "${instruction}" instruction)
+            list(APPEND ${prefix}_${current} "${instruction}")
+        endif()
+    endforeach()
+
+    set(${prefix}_kernels ${kernels} PARENT_SCOPE)
+    foreach(kernel IN LISTS kernels)
+        set(${prefix}_${kernel} ${${prefix}_${kernel}} PARENT_SCOPE)
+    endforeach()
+endfunction()
+
+disassemble(${RAW_OBJECT} raw)
+disassemble(${STRONG_OBJECT} strong)
+
+if(NOT raw_kernels)
+    message(FATAL_ERROR "No kernels found in ${RAW_OBJECT}")
+endif()
+
+set(failures 0)
+foreach(kernel IN LISTS raw_kernels)
+    if(NOT kernel IN_LIST strong_kernels)
+        message(SEND_ERROR "${kernel}: missing from ${STRONG_OBJECT}")
+        math(EXPR failures "${failures} + 1")
+        continue()
+    endif()
+    if(NOT "${raw_${kernel}}" STREQUAL "${strong_${kernel}}")
+        string(REPLACE ";" "\n    " raw_listing "${raw_${kernel}}")
+        string(REPLACE ";" "\n    " strong_listing "${strong_${kernel}}")
+        message(SEND_ERROR
+            "${kernel}: instruction streams differ\n"
+            "  raw:\n    ${raw_listing}\n"
+            "  strong:\n    ${strong_listing}")
+        math(EXPR failures "${failures} + 1")
+    else()
+        list(LENGTH raw_${kernel} count)
+        message(STATUS "${kernel}: identical (${count} instructions)")
+    endif()
+endforeach()
+
+if(failures GREATER 0)
+    message(FATAL_ERROR "${failures} kernel(s) differ between raw and strong types")
+endif()
\ No newline at end of file
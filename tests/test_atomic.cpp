@@ -0,0 +1,142 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using sequence = cina::new_type<struct SequenceTag, std::int64_t>;
+using small = cina::new_type<struct SmallTag, std::int16_t>;
+using mask = cina::new_type<struct MaskTag, std::uint32_t>;
+using level = cina::new_type<struct LevelTag, std::int16_t,
+                             cina::addition::with<cina::saturate>,
+                             cina::equality_comparison>;
+using checked = cina::new_type<struct CheckedTag, std::int32_t,
+                               cina::addition::with<cina::checked_expected>>;
+using opaque = cina::new_type<struct OpaqueTag, std::int32_t, cina::no_skills>;
+using percent = cina::range_integer<struct PercentTag, 0, 100>;
+
+namespace {
+template <typename T>
+concept has_fetch_add =
+    requires(cina::atomic<T> a, T v) { a.fetch_add(v); };
+
+template <typename T>
+concept has_fetch_or = requires(cina::atomic<T> a, T v) { a.fetch_or(v); };
+
+template <typename T>
+concept has_compare_exchange = requires(cina::atomic<T> a, T v) {
+  a.compare_exchange_strong(v, v);
+};
+} // namespace
+
+TEST(TestAtomic, TestLayout) {
+  EXPECT_EQ(sizeof(cina::atomic<sequence>), sizeof(std::atomic<std::int64_t>));
+  EXPECT_EQ(alignof(cina::atomic<sequence>),
+            alignof(std::atomic<std::int64_t>));
+  EXPECT_EQ(sizeof(cina::atomic<small>), sizeof(std::atomic<std::int16_t>));
+  EXPECT_EQ(sizeof(cina::atomic_ref<sequence>),
+            sizeof(std::atomic_ref<std::int64_t>));
+  EXPECT_TRUE(cina::atomic<sequence>::is_always_lock_free);
+  EXPECT_TRUE(cina::atomic<sequence>{}.is_lock_free());
+  EXPECT_FALSE(std::is_copy_constructible_v<cina::atomic<sequence>>);
+  EXPECT_TRUE((std::same_as<cina::atomic<sequence>::value_type, sequence>));
+}
+
+TEST(TestAtomic, TestSkills) {
+  EXPECT_TRUE(has_fetch_add<sequence>);
+  EXPECT_TRUE(has_fetch_add<level>);
+  EXPECT_FALSE(has_fetch_add<checked>);
+  EXPECT_FALSE(has_fetch_add<opaque>);
+  EXPECT_FALSE(has_fetch_add<percent>);
+  EXPECT_TRUE(has_fetch_or<mask>);
+  EXPECT_FALSE(has_fetch_or<sequence>);
+  EXPECT_TRUE(has_compare_exchange<sequence>);
+  EXPECT_TRUE(has_compare_exchange<opaque>);
+}
+
+TEST(TestAtomic, TestOperations) {
+  cina::atomic<sequence> a{sequence{5}};
+  EXPECT_EQ(a.load(), sequence{5});
+  a.store(sequence{7}, std::memory_order_relaxed);
+  EXPECT_EQ(a.exchange(sequence{9}), sequence{7});
+  EXPECT_EQ(a.fetch_add(sequence{1}), sequence{9});
+  EXPECT_EQ(a.fetch_sub(sequence{4}), sequence{10});
+  EXPECT_EQ(a.load(), sequence{6});
+
+  sequence expected{1};
+  EXPECT_FALSE(a.compare_exchange_strong(expected, sequence{2}));
+  EXPECT_EQ(expected, sequence{6});
+  EXPECT_TRUE(a.compare_exchange_strong(expected, sequence{2}));
+  EXPECT_EQ(a.load(), sequence{2});
+
+  cina::atomic<mask> m{mask{0b1100U}};
+  EXPECT_EQ(m.fetch_or(mask{0b0011U}), mask{0b1100U});
+  EXPECT_EQ(m.fetch_and(mask{0b0110U}), mask{0b1111U});
+  EXPECT_EQ(m.fetch_xor(mask{0b0100U}), mask{0b0110U});
+  EXPECT_EQ(m.load(), mask{0b0010U});
+
+  const cina::atomic<percent> p{percent{42}};
+  EXPECT_EQ(p.load(), percent{42});
+}
+
+TEST(TestAtomic, TestPolicy) {
+  constexpr std::int16_t max = std::numeric_limits<std::int16_t>::max();
+  cina::atomic<level> a{level{std::int16_t{max - 1}}};
+  EXPECT_EQ(a.fetch_add(level{std::int16_t{5}}), level{std::int16_t{max - 1}});
+  EXPECT_EQ(a.load(), level{max});
+
+  cina::atomic<small> b{small{max}};
+  b.fetch_add(small{std::int16_t{1}});
+  EXPECT_EQ(b.load(), small{std::numeric_limits<std::int16_t>::min()});
+}
+
+TEST(TestAtomic, TestConcurrentIncrement) {
+  constexpr int thread_count = 4;
+  constexpr int increments = 10'000;
+  cina::atomic<sequence> counter{sequence{0}};
+  cina::atomic<level> saturating{level{std::int16_t{0}}};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < increments; ++i) {
+        counter.fetch_add(sequence{1}, std::memory_order_relaxed);
+        saturating.fetch_add(level{std::int16_t{1}}, std::memory_order_relaxed);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.load(), sequence{thread_count * increments});
+  EXPECT_EQ(saturating.load(), level{std::int16_t{32'767}});
+}
+
+TEST(TestAtomic, TestAtomicRef) {
+  alignas(cina::atomic_ref<sequence>::required_alignment)
+      std::array<sequence, 4> values{sequence{1}, sequence{2}, sequence{3},
+                                     sequence{4}};
+  cina::atomic_ref<sequence> ref{values[2]};
+  EXPECT_EQ(ref.fetch_add(sequence{10}), sequence{3});
+  EXPECT_EQ(ref.load(), sequence{13});
+  const cina::atomic_ref<sequence> copy = ref;
+  EXPECT_EQ(copy.load(), sequence{13});
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&values] {
+      for (int i = 0; i < 1000; ++i) {
+        cina::atomic_ref<sequence>{values[0]}.fetch_add(sequence{1});
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(values[0], sequence{4001});
+  EXPECT_EQ(values[1], sequence{2});
+}
@@ -0,0 +1,93 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using strong_int = cina::new_type<struct IntTag, std::int32_t>;
+using strong_short = cina::new_type<struct ShortTag, std::int16_t>;
+using strong_bool = cina::new_type<struct BoolTag, bool>;
+using strong_double =
+    cina::new_type<struct DoubleTag, double, cina::binary_io,
+                   cina::equality_comparison>;
+
+TEST(TestBinaryIO, TestEndianness) {
+  std::array<std::byte, 4> buffer{};
+  EXPECT_EQ(encode(strong_int{0x01020304}, buffer, std::endian::little), 4U);
+  EXPECT_EQ(buffer[0], std::byte{0x04});
+  EXPECT_EQ(buffer[3], std::byte{0x01});
+
+  EXPECT_EQ(encode(strong_int{0x01020304}, buffer, std::endian::big), 4U);
+  EXPECT_EQ(buffer[0], std::byte{0x01});
+  EXPECT_EQ(buffer[3], std::byte{0x04});
+
+  strong_int value{0};
+  EXPECT_EQ(decode(buffer, value, std::endian::big), 4U);
+  EXPECT_EQ(value, strong_int{0x01020304});
+  EXPECT_EQ(decode(buffer, value, std::endian::little), 4U);
+  EXPECT_EQ(value, strong_int{0x04030201});
+}
+
+TEST(TestBinaryIO, TestRoundTrip) {
+  std::array<std::byte, 8> buffer{};
+  for (const std::endian order : {std::endian::little, std::endian::big}) {
+    strong_double d{0.0};
+    EXPECT_EQ(encode(strong_double{3.25}, buffer, order), 8U);
+    EXPECT_EQ(decode(buffer, d, order), 8U);
+    EXPECT_EQ(d, strong_double{3.25});
+
+    strong_short s{std::int16_t{0}};
+    EXPECT_EQ(encode(strong_short{std::int16_t{-2}}, buffer, order), 2U);
+    EXPECT_EQ(decode(buffer, s, order), 2U);
+    EXPECT_EQ(s, strong_short{std::int16_t{-2}});
+
+    strong_bool b{false};
+    EXPECT_EQ(encode(strong_bool{true}, buffer, order), 1U);
+    EXPECT_EQ(decode(buffer, b, order), 1U);
+    EXPECT_TRUE(b);
+  }
+}
+
+TEST(TestBinaryIO, TestBufferTooSmall) {
+  std::array<std::byte, 3> buffer{std::byte{1}, std::byte{2}, std::byte{3}};
+  EXPECT_EQ(encode(strong_int{-1}, buffer, std::endian::little), 0U);
+  EXPECT_EQ(buffer[0], std::byte{1});
+
+  strong_int value{7};
+  EXPECT_EQ(decode(buffer, value, std::endian::little), 0U);
+  EXPECT_EQ(value, strong_int{7});
+}
+
+TEST(TestBinaryIO, TestRange) {
+  const std::vector<strong_short> values{
+      strong_short{std::int16_t{1}}, strong_short{std::int16_t{-2}},
+      strong_short{std::int16_t{0x0102}}};
+  std::array<std::byte, 6> buffer{};
+  for (const std::endian order : {std::endian::little, std::endian::big}) {
+    EXPECT_EQ(encode(values, buffer, order), 6U);
+    std::vector<strong_short> decoded(values.size(),
+                                      strong_short{std::int16_t{0}});
+    EXPECT_EQ(decode(buffer, decoded, order), 6U);
+    EXPECT_EQ(decoded, values);
+  }
+  EXPECT_EQ(buffer[4], std::byte{0x01});
+  EXPECT_EQ(buffer[5], std::byte{0x02});
+
+  std::array<std::byte, 5> small{};
+  EXPECT_EQ(encode(values, small, std::endian::native), 0U);
+  std::vector<strong_short> too_many(4, strong_short{std::int16_t{0}});
+  EXPECT_EQ(decode(buffer, too_many, std::endian::native), 0U);
+}
+
+TEST(TestBinaryIO, TestBooleanNormalization) {
+  const std::array<std::byte, 2> buffer{std::byte{0}, std::byte{2}};
+  std::array<strong_bool, 2> values{strong_bool{true}, strong_bool{false}};
+  EXPECT_EQ(decode(buffer, values, std::endian::native), 2U);
+  EXPECT_FALSE(values[0]);
+  EXPECT_TRUE(values[1]);
+  EXPECT_EQ(values[1].unwrap(), true);
+}
@@ -0,0 +1,81 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+using strong_int = cina::new_type<struct IntTag, int>;
+using strong_schar = cina::new_type<struct SCharTag, signed char>;
+using strong_double =
+    cina::new_type<struct DoubleTag, double, cina::charconv,
+                   cina::equality_comparison>;
+using strong_bool = cina::new_type<struct BoolTag, bool>;
+
+namespace {
+template <typename T> auto print(const T& value, const auto... args) {
+  std::array<char, 64> buffer{};
+  const auto [ptr, ec] =
+      to_chars(buffer.data(), buffer.data() + buffer.size(), value, args...);
+  EXPECT_EQ(ec, std::errc{});
+  return std::string{buffer.data(), ptr};
+}
+
+template <typename T> constexpr bool has_to_chars = requires(char* p, T v) {
+  to_chars(p, p, v);
+};
+} // namespace
+
+TEST(TestCharconv, TestToChars) {
+  EXPECT_EQ(print(strong_int{-1234}), "-1234");
+  EXPECT_EQ(print(strong_int{255}, 16), "ff");
+  EXPECT_EQ(print(strong_schar{static_cast<signed char>(-65)}), "-65");
+  EXPECT_EQ(print(strong_double{0.5}), "0.5");
+  EXPECT_EQ(print(strong_double{1.0}, std::chars_format::scientific),
+            "1e+00");
+
+  std::array<char, 2> small{};
+  const auto result =
+      to_chars(small.data(), small.data() + small.size(), strong_int{123});
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
+TEST(TestCharconv, TestFromChars) {
+  constexpr std::string_view text = "-42 rest";
+  strong_int value{0};
+  const auto [ptr, ec] =
+      from_chars(text.data(), text.data() + text.size(), value);
+  EXPECT_EQ(ec, std::errc{});
+  EXPECT_EQ(ptr, text.data() + 3);
+  EXPECT_EQ(value, strong_int{-42});
+
+  constexpr std::string_view hex = "7f";
+  strong_schar small{static_cast<signed char>(0)};
+  EXPECT_EQ(from_chars(hex.data(), hex.data() + hex.size(), small, 16).ec,
+            std::errc{});
+  EXPECT_EQ(small.unwrap(), 127);
+
+  constexpr std::string_view too_big = "128";
+  EXPECT_EQ(
+      from_chars(too_big.data(), too_big.data() + too_big.size(), small).ec,
+      std::errc::result_out_of_range);
+  EXPECT_EQ(small.unwrap(), 127);
+
+  constexpr std::string_view floating = "2.5";
+  strong_double d{0.0};
+  EXPECT_EQ(
+      from_chars(floating.data(), floating.data() + floating.size(), d).ec,
+      std::errc{});
+  EXPECT_EQ(d, strong_double{2.5});
+}
+
+TEST(TestCharconv, TestAvailability) {
+  EXPECT_TRUE(has_to_chars<strong_int>);
+  EXPECT_FALSE(has_to_chars<strong_bool>);
+  EXPECT_FALSE((has_to_chars<cina::new_type<struct Tag, int,
+                                            cina::equality_comparison>>));
+}
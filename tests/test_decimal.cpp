@@ -0,0 +1,246 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+using price = cina::decimal<struct PriceTag, 18, 2>;
+using rate = cina::decimal<struct PriceTag, 18, 6>;
+using cents = cina::decimal<struct PriceTag, 4, 2>;
+using fraction = cina::decimal<struct PriceTag, 3, 3>;
+using wide_price = cina::decimal<struct PriceTag, 30, 4>;
+using whole = cina::decimal<struct PriceTag, 18, 0>;
+
+namespace {
+template <typename T> auto print(const T value) -> std::string {
+  std::array<char, T::max_chars> buffer{};
+  const auto [ptr, ec] =
+      to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  EXPECT_EQ(ec, std::errc{});
+  return std::string{buffer.data(), ptr};
+}
+
+template <typename T> auto parse(const std::string_view text) -> T {
+  T value = T::from_raw(-1);
+  const auto [ptr, ec] =
+      from_chars(text.data(), text.data() + text.size(), value);
+  EXPECT_EQ(ec, std::errc{}) << text;
+  EXPECT_EQ(ptr, text.data() + text.size()) << text;
+  return value;
+}
+
+template <cina::rounding Mode> constexpr auto divide_by_four(const int raw) {
+  return divide<Mode>(price::from_raw(raw), price{4}).raw();
+}
+} // namespace
+
+TEST(TestDecimal, TestProperties) {
+  EXPECT_EQ(sizeof(price), sizeof(std::int64_t));
+  EXPECT_EQ(sizeof(wide_price), 16U);
+  EXPECT_TRUE((std::same_as<price::storage_type, std::int64_t>));
+  EXPECT_TRUE(std::is_trivially_copyable_v<price>);
+  EXPECT_EQ(price::digits, 18);
+  EXPECT_EQ(price::scale, 2);
+  EXPECT_FALSE((std::is_constructible_v<price, double>));
+  EXPECT_FALSE((std::is_convertible_v<int, price>));
+  EXPECT_TRUE((std::three_way_comparable<price, std::strong_ordering>));
+}
+
+TEST(TestDecimal, TestConstruction) {
+  static_assert(price{3}.raw() == 300);
+  static_assert(price{-3}.raw() == -300);
+  static_assert(price::from_raw(1999).raw() == 1999);
+  static_assert(fraction{0}.raw() == 0);
+  static_assert(wide_price{std::int64_t{1} << 62}.raw() ==
+                static_cast<wide_price::storage_type>(std::int64_t{1} << 62) *
+                    10000);
+}
+
+TEST(TestDecimal, TestArithmetic) {
+  constexpr price a = price::from_raw(1050);
+  constexpr price b = price::from_raw(-275);
+  static_assert(a + b == price::from_raw(775));
+  static_assert(a - b == price::from_raw(1325));
+  static_assert(-a == price::from_raw(-1050));
+  static_assert(a * 3 == price::from_raw(3150));
+  static_assert(3 * a == a * 3);
+  static_assert(a > b);
+
+  // 10.50 * -2.75 = -28.875, a tie that rounds to the even -28.88.
+  static_assert(a * b == price::from_raw(-2888));
+  // Ties whose integer part contributes an odd count of cents: 1.10 * 0.25 =
+  // 0.275 rounds to 0.28 and 3.30 * 0.25 = 0.825 rounds to 0.82.
+  static_assert(price::from_raw(110) * price::from_raw(25) ==
+                price::from_raw(28));
+  static_assert(price::from_raw(-110) * price::from_raw(25) ==
+                price::from_raw(-28));
+  static_assert(price::from_raw(330) * price::from_raw(25) ==
+                price::from_raw(82));
+  // 10.50 / 3.00 = 3.5
+  static_assert(a / price{3} == price::from_raw(350));
+  // 1.00 / 3.00 = 0.333...
+  static_assert(price{1} / price{3} == price::from_raw(33));
+  static_assert(price{2} / price{3} == price::from_raw(67));
+  static_assert(price{-2} / price{3} == price::from_raw(-67));
+
+  price c{1};
+  c += a;
+  EXPECT_EQ(c, price::from_raw(1150));
+  c -= price{2};
+  EXPECT_EQ(c, price::from_raw(950));
+  c *= 2;
+  EXPECT_EQ(c, price{19});
+  c *= price::from_raw(50);
+  EXPECT_EQ(c, price::from_raw(950));
+  c /= price::from_raw(-200);
+  EXPECT_EQ(c, price::from_raw(-475));
+}
+
+TEST(TestDecimal, TestRoundingModes) {
+  using cina::rounding;
+  // 0.10 / 4 = 0.025, 0.06 / 4 = 0.015, 0.07 / 4 = 0.0175
+  static_assert(divide_by_four<rounding::half_even>(10) == 2);
+  static_assert(divide_by_four<rounding::half_even>(6) == 2);
+  static_assert(divide_by_four<rounding::half_even>(-10) == -2);
+  static_assert(divide_by_four<rounding::half_away_from_zero>(10) == 3);
+  static_assert(divide_by_four<rounding::half_away_from_zero>(-10) == -3);
+  static_assert(divide_by_four<rounding::half_toward_zero>(10) == 2);
+  static_assert(divide_by_four<rounding::half_toward_zero>(7) == 2);
+  static_assert(divide_by_four<rounding::half_toward_zero>(-7) == -2);
+  static_assert(divide_by_four<rounding::truncate>(7) == 1);
+  static_assert(divide_by_four<rounding::truncate>(-7) == -1);
+  static_assert(divide_by_four<rounding::away_from_zero>(5) == 2);
+  static_assert(divide_by_four<rounding::away_from_zero>(-5) == -2);
+  static_assert(divide_by_four<rounding::floor>(7) == 1);
+  static_assert(divide_by_four<rounding::floor>(-7) == -2);
+  static_assert(divide_by_four<rounding::ceiling>(7) == 2);
+  static_assert(divide_by_four<rounding::ceiling>(-7) == -1);
+  static_assert(divide_by_four<rounding::ceiling>(8) == 2);
+
+  // With no fractional digits the quotient is rounded as a whole: 3 / 2 and
+  // 5 / 2 both tie to 2.
+  static_assert(whole{3} / whole{2} == whole{2});
+  static_assert(whole{5} / whole{2} == whole{2});
+  static_assert(whole{-3} / whole{2} == whole{-2});
+  static_assert(whole{3} / whole{-2} == whole{-2});
+  static_assert(divide<rounding::half_toward_zero>(whole{3}, whole{2}) ==
+                whole{1});
+  static_assert(divide<rounding::half_away_from_zero>(whole{5}, whole{-2}) ==
+                whole{-3});
+
+  constexpr price a = price::from_raw(105);
+  constexpr price b = price::from_raw(-105);
+  // 1.05 * 1.05 = 1.1025 and 1.05 * -1.05 = -1.1025
+  static_assert(multiply<rounding::truncate>(a, a).raw() == 110);
+  static_assert(multiply<rounding::ceiling>(a, a).raw() == 111);
+  static_assert(multiply<rounding::floor>(a, b).raw() == -111);
+  static_assert(multiply<rounding::truncate>(a, b).raw() == -110);
+  static_assert(multiply<rounding::half_even>(b, b).raw() == 110);
+  // 1.10 * 0.25 = 0.275
+  static_assert(multiply<rounding::half_even>(price::from_raw(110),
+                                              price::from_raw(25))
+                    .raw() == 28);
+  static_assert(multiply<rounding::half_toward_zero>(price::from_raw(110),
+                                                     price::from_raw(-25))
+                    .raw() == -27);
+  static_assert(multiply<rounding::floor>(price::from_raw(110),
+                                          price::from_raw(-25))
+                    .raw() == -28);
+}
+
+TEST(TestDecimal, TestCast) {
+  using cina::decimal_cast;
+  using cina::rounding;
+  static_assert(decimal_cast<rate>(price::from_raw(-1234)).raw() ==
+                -12'340'000);
+  static_assert(decimal_cast<price>(rate::from_raw(1'234'500)).raw() == 123);
+  static_assert(decimal_cast<price>(rate::from_raw(1'235'000)).raw() == 124);
+  static_assert(
+      decimal_cast<price, rounding::half_away_from_zero>(
+          rate::from_raw(-1'235'000))
+          .raw() == -124);
+  static_assert(
+      decimal_cast<price, rounding::floor>(rate::from_raw(1'239'999)).raw() ==
+      123);
+  static_assert(decimal_cast<wide_price>(price::from_raw(-1)).raw() == -100);
+}
+
+TEST(TestDecimal, TestToChars) {
+  EXPECT_EQ(print(price::from_raw(12345)), "123.45");
+  EXPECT_EQ(print(price::from_raw(-5)), "-0.05");
+  EXPECT_EQ(print(price{0}), "0.00");
+  EXPECT_EQ(print(fraction::from_raw(7)), "0.007");
+  EXPECT_EQ(print(cina::decimal<struct Tag, 5, 0>{-42}), "-42");
+  EXPECT_EQ(print(price::from_raw(INT64_MIN)), "-92233720368547758.08");
+  EXPECT_EQ(print(wide_price{std::int64_t{-1'000'000'000'000'000'000}} *
+                  1000),
+            "-1000000000000000000000.0000");
+
+  std::array<char, 4> small{};
+  const auto result = to_chars(small.data(), small.data() + small.size(),
+                               price::from_raw(12345));
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+  EXPECT_EQ(result.ptr, small.data() + small.size());
+}
+
+TEST(TestDecimal, TestFromChars) {
+  EXPECT_EQ(parse<price>("123.45"), price::from_raw(12345));
+  EXPECT_EQ(parse<price>("-0.5"), price::from_raw(-50));
+  EXPECT_EQ(parse<price>("7"), price{7});
+  EXPECT_EQ(parse<price>(".25"), price::from_raw(25));
+  EXPECT_EQ(parse<price>("3."), price{3});
+  EXPECT_EQ(parse<price>("000012.30"), price::from_raw(1230));
+  EXPECT_EQ(parse<fraction>("0.125"), fraction::from_raw(125));
+  EXPECT_EQ(print(parse<wide_price>("-12345678901234567890123456.789")),
+            "-12345678901234567890123456.7890");
+
+  // Excess fractional digits round half to even.
+  EXPECT_EQ(parse<price>("1.005"), price::from_raw(100));
+  EXPECT_EQ(parse<price>("1.015"), price::from_raw(102));
+  EXPECT_EQ(parse<price>("1.0050001"), price::from_raw(101));
+  EXPECT_EQ(parse<price>("-1.0151"), price::from_raw(-102));
+  EXPECT_EQ(parse<cents>("99.994"), cents::from_raw(9999));
+
+  constexpr std::string_view text = "-1.5 rest";
+  price value{0};
+  const auto [ptr, ec] =
+      from_chars(text.data(), text.data() + text.size(), value);
+  EXPECT_EQ(ec, std::errc{});
+  EXPECT_EQ(ptr, text.data() + 4);
+  EXPECT_EQ(value, price::from_raw(-150));
+}
+
+TEST(TestDecimal, TestFromCharsErrors) {
+  const auto error = [](const std::string_view text) {
+    cents value{1};
+    const auto result =
+        from_chars(text.data(), text.data() + text.size(), value);
+    EXPECT_EQ(value, cents{1}) << text;
+    return result.ec;
+  };
+  EXPECT_EQ(error(""), std::errc::invalid_argument);
+  EXPECT_EQ(error("-"), std::errc::invalid_argument);
+  EXPECT_EQ(error("."), std::errc::invalid_argument);
+  EXPECT_EQ(error("+1"), std::errc::invalid_argument);
+  EXPECT_EQ(error("abc"), std::errc::invalid_argument);
+  EXPECT_EQ(error("100"), std::errc::result_out_of_range);
+  EXPECT_EQ(error("99.995"), std::errc::result_out_of_range);
+  EXPECT_EQ(error("123456789012345678901234567890123456789012"),
+            std::errc::result_out_of_range);
+  EXPECT_EQ(parse<cents>("99.99"), cents::from_raw(9999));
+}
+
+TEST(TestDecimal, TestStreams) {
+  std::ostringstream os;
+  os << price::from_raw(-12345) << ' ' << fraction::from_raw(50) << ' '
+     << wide_price{12};
+  EXPECT_EQ(os.str(), "-123.45 0.050 12.0000");
+}
@@ -0,0 +1,152 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+enum class color : std::uint8_t { red, green, blue };
+enum class level : std::int8_t { low = -1, normal, high };
+enum class code : int { ok = 0, moved = 30, missing = 44, failed = 255 };
+enum unscoped : unsigned char { alpha = 1, beta, gamma };
+// The first eight and last eight characters of the first two names match.
+enum class similar { prefix__a_suffix_, prefix__b_suffix_, prefix__c_suffix };
+
+enum class message : std::uint16_t {
+  logon, logout, heartbeat, test_request, resend_request, reject,
+  sequence_reset, execution_report, order_cancel_reject, new_order_single,
+  order_cancel_request, order_cancel_replace_request, order_status_request,
+  allocation, list_cancel_request, list_execute, list_status_request,
+  list_status, allocation_ack, dont_know_trade, quote_request, quote,
+  settlement_instructions, market_data_request, market_data_snapshot,
+  market_data_incremental_refresh, market_data_request_reject,
+  quote_cancel, quote_status_request, mass_quote_acknowledgement,
+  security_definition_request, security_definition
+};
+} // namespace
+
+using color_type = cina::enumeration<struct ColorTag, color>;
+using level_type = cina::enumeration<struct LevelTag, level>;
+using code_type = cina::enumeration<struct CodeTag, code>;
+using unscoped_type = cina::enumeration<struct UnscopedTag, unscoped>;
+using message_type = cina::enumeration<struct MessageTag, message>;
+using similar_type = cina::enumeration<struct SimilarTag, similar>;
+
+TEST(TestEnumeration, TestProperties) {
+  EXPECT_EQ(sizeof(color_type), sizeof(color));
+  EXPECT_TRUE(std::is_trivially_copyable_v<color_type>);
+  EXPECT_TRUE((std::same_as<color_type::enum_type, color>));
+  EXPECT_FALSE(std::is_default_constructible_v<color_type>);
+  EXPECT_FALSE((std::is_convertible_v<color, color_type>));
+  EXPECT_FALSE((std::is_constructible_v<color_type, level>));
+  EXPECT_TRUE((std::three_way_comparable<color_type, std::strong_ordering>));
+  EXPECT_EQ(color_type::size, 3U);
+  EXPECT_EQ(level_type::size, 3U);
+  EXPECT_EQ(code_type::size, 4U);
+  EXPECT_EQ(message_type::size, 32U);
+}
+
+TEST(TestEnumeration, TestConstruction) {
+  static_assert(color_type{color::blue}.unwrap() == color::blue);
+  EXPECT_THROW(color_type{static_cast<color>(3)}, cina::constraint_error);
+  EXPECT_THROW(code_type{static_cast<code>(31)}, cina::constraint_error);
+  EXPECT_THROW(code_type{static_cast<code>(-1)}, cina::constraint_error);
+  EXPECT_NO_THROW(code_type{code::missing});
+}
+
+TEST(TestEnumeration, TestNames) {
+  static_assert(color_type{color::green}.name() == "green");
+  static_assert(level_type{level::low}.name() == "low");
+  static_assert(code_type{code::failed}.name() == "failed");
+  static_assert(unscoped_type{gamma}.name() == "gamma");
+  static_assert(message_type{message::security_definition}.name() ==
+                "security_definition");
+
+  constexpr auto names = code_type::names();
+  static_assert(names.size() == 4);
+  EXPECT_EQ(names[0], "ok");
+  EXPECT_EQ(names[1], "moved");
+  EXPECT_EQ(names[2], "missing");
+  EXPECT_EQ(names[3], "failed");
+}
+
+TEST(TestEnumeration, TestFromString) {
+  static_assert(color_type::from_string("blue") == color_type{color::blue});
+  static_assert(!color_type::from_string("Blue"));
+  static_assert(!color_type::from_string(""));
+  static_assert(!color_type::from_string("blue "));
+  static_assert(level_type::from_string("low") == level_type{level::low});
+  static_assert(unscoped_type::from_string("alpha") == unscoped_type{alpha});
+
+  for (std::size_t pos = 0; pos < message_type::size; ++pos) {
+    const message_type value = message_type::from_pos(pos);
+    const std::optional<message_type> parsed =
+        message_type::from_string(value.name());
+    ASSERT_TRUE(parsed.has_value()) << value.name();
+    EXPECT_EQ(*parsed, value);
+    EXPECT_FALSE(
+        message_type::from_string(std::string{value.name()} + "_"));
+  }
+  EXPECT_FALSE(code_type::from_string("message"));
+
+  static_assert(similar_type::from_string("prefix__b_suffix_") ==
+                similar_type{similar::prefix__b_suffix_});
+  static_assert(!similar_type::from_string("prefix__d_suffix_"));
+}
+
+TEST(TestEnumeration, TestPositions) {
+  static_assert(color_type::first() == color_type{color::red});
+  static_assert(color_type::last() == color_type{color::blue});
+  static_assert(level_type::first().pos() == 0);
+  static_assert(level_type{level::high}.pos() == 2);
+  static_assert(code_type{code::missing}.pos() == 2);
+  static_assert(code_type::from_pos(1) == code_type{code::moved});
+  static_assert(code_type{code::moved}.succ() == code_type{code::missing});
+  static_assert(code_type{code::moved}.pred() == code_type{code::ok});
+  static_assert(level_type{level::normal}.pred() == level_type::first());
+
+  EXPECT_THROW((void)code_type::last().succ(), cina::constraint_error);
+  EXPECT_THROW((void)code_type::first().pred(), cina::constraint_error);
+  EXPECT_THROW((void)code_type::from_pos(4), cina::constraint_error);
+
+  std::array<int, code_type::size> counts{};
+  for (const code c : {code::ok, code::failed, code::failed}) {
+    ++counts[code_type{c}.pos()];
+  }
+  EXPECT_EQ(counts, (std::array<int, 4>{1, 0, 0, 2}));
+
+  std::string visited;
+  for (auto c = color_type::first();; c = c.succ()) {
+    visited += c.name();
+    if (c == color_type::last()) {
+      break;
+    }
+  }
+  EXPECT_EQ(visited, "redgreenblue");
+}
+
+TEST(TestEnumeration, TestComparison) {
+  static_assert(level_type{level::low} < level_type{level::high});
+  static_assert(code_type{code::failed} > code_type{code::ok});
+  EXPECT_EQ(color_type{color::red} <=> color_type{color::green},
+            std::strong_ordering::less);
+}
+
+TEST(TestEnumeration, TestStreams) {
+  std::ostringstream os;
+  os << color_type{color::green} << ' ' << level_type{level::low};
+  EXPECT_EQ(os.str(), "green low");
+}
+
+TEST(TestEnumeration, TestHash) {
+  EXPECT_EQ(std::hash<color_type>{}(color_type{color::blue}),
+            std::hash<color>{}(color::blue));
+}
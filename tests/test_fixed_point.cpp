@@ -0,0 +1,125 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+using q15 = cina::fixed_point<struct SignalTag, std::int16_t, 15>;
+using q16_16 = cina::fixed_point<struct SignalTag, std::int32_t, 16>;
+using q8_8 = cina::fixed_point<struct SignalTag, std::int16_t, 8>;
+using q32_32 = cina::fixed_point<struct SignalTag, std::int64_t, 32>;
+
+TEST(TestFixedPoint, TestProperties) {
+  EXPECT_EQ(sizeof(q15), sizeof(std::int16_t));
+  EXPECT_TRUE(std::is_trivially_copyable_v<q16_16>);
+  EXPECT_TRUE((std::same_as<q16_16::storage_type, std::int32_t>));
+  EXPECT_TRUE((std::same_as<q16_16::base_integer_type,
+                            cina::signed_integer_type<SignalTag, std::int32_t>>));
+  EXPECT_EQ(q16_16::fractional_bits, 16);
+  EXPECT_EQ(q8_8::delta, 1.0 / 256.0);
+  EXPECT_FALSE((std::is_convertible_v<q16_16, double>));
+  EXPECT_FALSE((std::is_convertible_v<double, q16_16>));
+  EXPECT_TRUE((std::three_way_comparable<q16_16, std::strong_ordering>));
+
+  // The wide type is selected by size, so long and long long both work
+  // whichever of them is std::int64_t.
+  using q_long = cina::fixed_point<struct SignalTag, long, 16>;
+  using q_long_long = cina::fixed_point<struct SignalTag, long long, 16>;
+  EXPECT_TRUE((std::same_as<q_long::storage_type, long>));
+  EXPECT_TRUE((std::same_as<q_long_long::storage_type, long long>));
+  static_assert((q_long{1.5} * q_long{2}).raw() == 3L << 16);
+  static_assert((q_long_long{1.5} * q_long_long{2}).raw() == 3LL << 16);
+}
+
+TEST(TestFixedPoint, TestConstruction) {
+  static_assert(q16_16{1.5}.raw() == 0x18000);
+  static_assert(q16_16{-1.5}.raw() == -0x18000);
+  static_assert(q16_16{3}.raw() == 3 << 16);
+  static_assert(q16_16{-3}.raw() == -(3 << 16));
+  static_assert(q15{0.5}.raw() == 1 << 14);
+  static_assert(q8_8{1.0 / 512.0}.raw() == 1);
+  static_assert(q16_16::from_raw(42).raw() == 42);
+  static_assert(q16_16{2}.base().unwrap() == 2 << 16);
+
+  EXPECT_EQ(static_cast<double>(q16_16{0.25}), 0.25);
+  EXPECT_EQ(static_cast<float>(q8_8{-2.5}), -2.5F);
+
+  // Values whose nearest value is outside the range are rejected.
+  static_assert(q15{-1.0}.raw() == -32768);
+  static_assert(q8_8{127.99}.raw() == 32765);
+  EXPECT_THROW(q15{1.0}, cina::constraint_error);
+  EXPECT_THROW(q15{0.99999}, cina::constraint_error);
+  EXPECT_THROW(q15{-1.01}, cina::constraint_error);
+  EXPECT_THROW(q8_8{1e30}, cina::constraint_error);
+  EXPECT_THROW(q8_8{std::numeric_limits<double>::quiet_NaN()},
+               cina::constraint_error);
+  EXPECT_THROW(q32_32{std::numeric_limits<float>::infinity()},
+               cina::constraint_error);
+}
+
+TEST(TestFixedPoint, TestRescale) {
+  static_assert(q16_16{q8_8{1.75}}.raw() == q16_16{1.75}.raw());
+  static_assert(q8_8{q16_16{1.75}}.raw() == q8_8{1.75}.raw());
+  static_assert(q8_8{q16_16::from_raw(0x1ff)}.raw() == 1);
+  static_assert(q32_32{q15{-0.5}}.raw() == -(std::int64_t{1} << 31));
+}
+
+TEST(TestFixedPoint, TestArithmetic) {
+  constexpr q16_16 a{1.5};
+  constexpr q16_16 b{-2.25};
+  static_assert(a + b == q16_16{-0.75});
+  static_assert(a - b == q16_16{3.75});
+  static_assert(a * b == q16_16{-3.375});
+  static_assert(b / a == q16_16{-1.5});
+  static_assert(-a == q16_16{-1.5});
+  static_assert(a > b);
+
+  // 0.5 * 0.5 in Q15 needs the double-width intermediate.
+  static_assert(q15{0.5} * q15{0.5} == q15{0.25});
+  static_assert(q15{0.5} / q15{-0.75} == q15::from_raw(-21845));
+  static_assert(q32_32{1.5} * q32_32{4} == q32_32{6});
+  static_assert(q32_32{1} / q32_32{3} == q32_32::from_raw(0x55555555));
+
+  // Inexact products truncate toward zero, matching division: -1.5 ulp is
+  // -1 ulp, not -2.
+  static_assert(q8_8::from_raw(3) * q8_8{-0.5} == q8_8::from_raw(-1));
+  static_assert(q8_8::from_raw(-3) * q8_8{0.5} == q8_8::from_raw(-1));
+  static_assert(q8_8::from_raw(3) * q8_8{0.5} == q8_8::from_raw(1));
+  static_assert(q8_8::from_raw(-3) / q8_8{2} == q8_8::from_raw(-1));
+
+  q16_16 c{1};
+  c += a;
+  EXPECT_EQ(c, q16_16{2.5});
+  c -= q16_16{0.5};
+  EXPECT_EQ(c, q16_16{2});
+  c *= b;
+  EXPECT_EQ(c, q16_16{-4.5});
+  c /= q16_16{-3};
+  EXPECT_EQ(c, q16_16{1.5});
+}
+
+TEST(TestFixedPoint, TestAccuracy) {
+  // Multiplication and division truncate, so the result is within one delta
+  // of the exact result for the quantized operands.
+  for (int i = -100; i <= 100; ++i) {
+    const q16_16 x{i / 7.0};
+    for (int j = 1; j <= 50; ++j) {
+      const q16_16 y{j / 3.0};
+      const double exact_x = static_cast<double>(x);
+      const double exact_y = static_cast<double>(y);
+      EXPECT_NEAR(static_cast<double>(x * y), exact_x * exact_y, q16_16::delta);
+      EXPECT_NEAR(static_cast<double>(x / y), exact_x / exact_y, q16_16::delta);
+    }
+  }
+}
+
+TEST(TestFixedPoint, TestStreams) {
+  std::ostringstream os;
+  os << q16_16{-1.25} << ' ' << q8_8{3};
+  EXPECT_EQ(os.str(), "-1.25 3");
+}
@@ -0,0 +1,147 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace {
+enum class permission : std::uint8_t { read, write, execute };
+enum class feature : int { a, b, c, d, e, f, g, h, i };
+enum class sparse : int { low = -3, mid = 7, high = 100 };
+enum class wide : std::uint8_t {
+  f00, f01, f02, f03, f04, f05, f06, f07, f08, f09, f10, f11, f12, f13, f14,
+  f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+  f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+  f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59,
+  f60, f61, f62, f63
+};
+} // namespace
+
+using permissions = cina::flags<struct PermissionTag, permission>;
+using features = cina::flags<struct FeatureTag, feature>;
+using sparse_flags = cina::flags<struct SparseTag, sparse>;
+using wide_flags = cina::flags<struct WideTag, wide>;
+
+TEST(TestFlags, TestStorage) {
+  EXPECT_TRUE((std::same_as<permissions::storage_type, std::uint8_t>));
+  EXPECT_TRUE((std::same_as<features::storage_type, std::uint16_t>));
+  EXPECT_TRUE((std::same_as<wide_flags::storage_type, std::uint64_t>));
+  EXPECT_EQ(sizeof(permissions), 1U);
+  EXPECT_EQ(sizeof(wide_flags), 8U);
+  EXPECT_TRUE(std::is_trivially_copyable_v<features>);
+  EXPECT_FALSE((std::is_convertible_v<permissions, std::uint8_t>));
+  EXPECT_FALSE((std::is_constructible_v<permissions, features>));
+  EXPECT_TRUE(std::forward_iterator<permissions::iterator>);
+  // Dereferencing yields a prvalue, so the legacy category is input only.
+  EXPECT_TRUE((std::same_as<
+               std::iterator_traits<permissions::iterator>::iterator_category,
+               std::input_iterator_tag>));
+  EXPECT_EQ(permissions::size, 3U);
+  EXPECT_EQ(wide_flags::size, 64U);
+}
+
+TEST(TestFlags, TestConstruction) {
+  static_assert(permissions{}.raw() == 0);
+  static_assert(permissions{}.empty());
+  static_assert(permissions::none() == permissions{});
+  static_assert(permissions::all().raw() == 0b111);
+  static_assert(wide_flags::all().raw() == ~std::uint64_t{0});
+  static_assert(permissions{permission::read, permission::execute}.raw() ==
+                0b101);
+  static_assert(sparse_flags{sparse::high}.raw() == 0b100);
+  static_assert(features::from_raw(0x1ff) == features::all());
+
+  EXPECT_THROW((void)permissions::from_raw(0b1000), cina::constraint_error);
+  EXPECT_THROW((void)features::from_raw(0x200), cina::constraint_error);
+  EXPECT_NO_THROW((void)wide_flags::from_raw(~std::uint64_t{0}));
+}
+
+TEST(TestFlags, TestSetOperations) {
+  constexpr permissions rw{permission::read, permission::write};
+  constexpr permissions wx{permission::write, permission::execute};
+  static_assert((rw | wx) == permissions::all());
+  static_assert((rw & wx) == permissions{permission::write});
+  static_assert((rw ^ wx) ==
+                permissions{permission::read, permission::execute});
+  static_assert(~rw == permissions{permission::execute});
+  static_assert(~permissions::all() == permissions::none());
+  static_assert(~wide_flags{wide::f63} ==
+                wide_flags::from_raw(~std::uint64_t{0} >> 1));
+
+  permissions p = rw;
+  p |= wx;
+  EXPECT_EQ(p, permissions::all());
+  p &= wx;
+  EXPECT_EQ(p, wx);
+  p ^= rw;
+  EXPECT_EQ(p, (permissions{permission::read, permission::execute}));
+}
+
+TEST(TestFlags, TestQueries) {
+  constexpr features set{feature::a, feature::d, feature::i};
+  static_assert(set.contains(feature::d));
+  static_assert(!set.contains(feature::b));
+  static_assert(!set.contains(static_cast<feature>(42)));
+  static_assert(set.contains(features{feature::a, feature::i}));
+  static_assert(!set.contains(features{feature::a, feature::b}));
+  static_assert(set.contains(features{}));
+  static_assert(set.intersects(features{feature::b, feature::i}));
+  static_assert(!set.intersects(features{feature::b, feature::c}));
+  static_assert(set.count() == 3);
+  static_assert(wide_flags::all().count() == 64);
+
+  features f;
+  f.insert(feature::e).insert(feature::g);
+  EXPECT_EQ(f, (features{feature::e, feature::g}));
+  f.erase(feature::e).erase(feature::a);
+  EXPECT_EQ(f, features{feature::g});
+}
+
+TEST(TestFlags, TestIteration) {
+  constexpr sparse_flags set{sparse::low, sparse::high};
+  std::vector<sparse> visited(set.begin(), set.end());
+  EXPECT_EQ(visited, (std::vector<sparse>{sparse::low, sparse::high}));
+
+  std::size_t count = 0;
+  for (const wide flag : wide_flags::all()) {
+    EXPECT_EQ(static_cast<std::size_t>(flag), count);
+    ++count;
+  }
+  EXPECT_EQ(count, 64U);
+  EXPECT_EQ(permissions{}.begin(), permissions{}.end());
+}
+
+TEST(TestFlags, TestBulk) {
+  const std::array<features, 3> lhs{features{feature::a, feature::b},
+                                    features::all(), features{}};
+  const std::array<features, 3> rhs{features{feature::b, feature::c},
+                                    features{feature::h}, features{feature::i}};
+  std::array<features, 3> out{};
+
+  features::bulk_or(lhs, rhs, out);
+  EXPECT_EQ(out[0], (features{feature::a, feature::b, feature::c}));
+  EXPECT_EQ(out[1], features::all());
+  EXPECT_EQ(out[2], features{feature::i});
+
+  features::bulk_and(lhs, rhs, out);
+  EXPECT_EQ(out[0], features{feature::b});
+  EXPECT_EQ(out[1], features{feature::h});
+  EXPECT_EQ(out[2], features{});
+
+  EXPECT_EQ(features::bulk_count(lhs), 11U);
+  const std::array<wide_flags, 2> wide_sets{wide_flags::all(),
+                                            wide_flags{wide::f07}};
+  EXPECT_EQ(wide_flags::bulk_count(wide_sets), 65U);
+}
+
+TEST(TestFlags, TestStreams) {
+  std::ostringstream os;
+  os << permissions{permission::read, permission::execute} << ' '
+     << permissions{} << '.';
+  EXPECT_EQ(os.str(), "read|execute .");
+}
@@ -0,0 +1,87 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <string_view>
+
+namespace {
+std::size_t allocation_count{};
+} // namespace
+
+auto operator new(std::size_t size) -> void* {
+  ++allocation_count;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void {
+  std::free(ptr);
+}
+
+TEST(TestFormat, TestMatchesUnderlyingFormat) {
+  using type = cina::new_type<struct Tag, int>;
+  const type a{3054};
+  EXPECT_EQ(std::format("{}", a), std::format("{}", 3054));
+  EXPECT_EQ(std::format("{:08x}", a), std::format("{:08x}", 3054));
+  EXPECT_EQ(std::format("{:+d}", a), std::format("{:+d}", 3054));
+  EXPECT_EQ(std::format("{:>10}", a), std::format("{:>10}", 3054));
+  EXPECT_EQ(std::format("{:#b}", a), std::format("{:#b}", 3054));
+
+  using small = cina::new_type<struct Tag2, signed char>;
+  const small b{static_cast<signed char>(-12)};
+  EXPECT_EQ(std::format("{}", b), "-12");
+
+  using floating = cina::strong_type<struct Tag3, double>;
+  const floating c{3.14159};
+  EXPECT_EQ(std::format("{:.3f}", c), std::format("{:.3f}", 3.14159));
+  EXPECT_EQ(std::format("{:e}", c), std::format("{:e}", 3.14159));
+
+  using boolean = cina::new_type<struct Tag4, bool>;
+  const boolean d{true};
+  EXPECT_EQ(std::format("{:d}", d), "1");
+  EXPECT_EQ(std::format("{:>6}", d), std::format("{:>6}", true));
+
+  using reference = cina::new_type<struct Tag5, const int&>;
+  const int value{255};
+  const reference ref{value};
+  EXPECT_EQ(std::format("{:#06x}", ref), std::format("{:#06x}", 255));
+}
+
+TEST(TestFormat, TestNoAllocations) {
+  using type = cina::new_type<struct Tag, long long>;
+  const type a{-9'876'543'210};
+  std::array<char, 64> buffer{};
+
+  const std::size_t before = allocation_count;
+  for (int i = 0; i < 1000; ++i) {
+    std::format_to_n(buffer.data(), buffer.size(), "{} {:016x} {:>24}", a,
+                     a.unwrap() + i, a);
+  }
+  EXPECT_EQ(allocation_count, before);
+
+  const auto result =
+      std::format_to_n(buffer.data(), buffer.size(), "{:+}", a);
+  EXPECT_EQ(std::string_view(buffer.data(), result.out), "-9876543210");
+}
+TEST(TestFormat, TestDecimal) {
+  using price = cina::decimal<struct PriceTag, 18, 2>;
+  EXPECT_EQ(std::format("{}", price::from_raw(-12345)), "-123.45");
+  EXPECT_EQ(std::format("{:>8}", price{7}), "    7.00");
+  EXPECT_EQ(std::format("{:*<6}", price::from_raw(5)), "0.05**");
+}
+
+TEST(TestFormat, TestEnumeration) {
+  enum class color : unsigned char { red, green };
+  using type = cina::enumeration<struct ColorTag, color>;
+  EXPECT_EQ(std::format("{}", type{color::green}), "green");
+  EXPECT_EQ(std::format("{:>5}", type{color::red}), "  red");
+}
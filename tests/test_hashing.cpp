@@ -0,0 +1,65 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+
+namespace {
+struct constant_mixer {
+  constexpr auto operator()(std::uint64_t) const noexcept -> std::uint64_t {
+    return 7;
+  }
+};
+
+enum class color : std::uint8_t { red, green };
+} // namespace
+
+using plain_id = cina::new_type<struct PlainTag, std::int32_t>;
+using mixed_id = cina::new_type<struct MixedTag, std::int32_t,
+                                cina::equality_comparison, cina::hashing>;
+using custom_id =
+    cina::new_type<struct CustomTag, std::uint64_t, cina::equality_comparison,
+                   cina::hashing::with<constant_mixer>>;
+using mixed_color = cina::new_type<struct ColorTag, color,
+                                   cina::equality_comparison, cina::hashing>;
+
+TEST(TestHashing, TestSplitmix64) {
+  static_assert(cina::splitmix64{}(0) == 0xe220a8397b1dcdafU);
+  EXPECT_NE(cina::splitmix64{}(1), cina::splitmix64{}(2));
+}
+
+TEST(TestHashing, TestDefaultHashUnchanged) {
+  EXPECT_EQ(std::hash<plain_id>{}(plain_id{42}), std::hash<std::int32_t>{}(42));
+}
+
+TEST(TestHashing, TestMixedHash) {
+  static_assert(std::is_nothrow_invocable_v<std::hash<mixed_id>, mixed_id>);
+  EXPECT_EQ(std::hash<mixed_id>{}(mixed_id{0}),
+            static_cast<std::size_t>(cina::splitmix64{}(0)));
+  EXPECT_EQ(std::hash<mixed_id>{}(mixed_id{-1}),
+            static_cast<std::size_t>(cina::splitmix64{}(0xffffffffU)));
+  EXPECT_EQ(std::hash<custom_id>{}(custom_id{123U}), 7U);
+  EXPECT_EQ(std::hash<mixed_color>{}(mixed_color{color::green}),
+            static_cast<std::size_t>(cina::splitmix64{}(1)));
+}
+
+TEST(TestHashing, TestLowBitsSpread) {
+  // Strided keys differ only in their high bits; after mixing the low bits
+  // used to select a bucket must still differ.
+  std::unordered_set<std::size_t> buckets;
+  for (std::int32_t i = 0; i < 64; ++i) {
+    buckets.insert(std::hash<mixed_id>{}(mixed_id{i * 1024}) & 63U);
+  }
+  EXPECT_GT(buckets.size(), 32U);
+
+  std::unordered_set<mixed_id> set;
+  for (std::int32_t i = 0; i < 100; ++i) {
+    set.insert(mixed_id{i});
+  }
+  EXPECT_EQ(set.size(), 100U);
+  EXPECT_EQ(set.count(mixed_id{50}), 1U);
+}
@@ -0,0 +1,124 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace {
+template <typename T, typename U>
+constexpr bool same_layout =
+    std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T> &&
+    sizeof(T) == sizeof(U) && alignof(T) == alignof(U);
+
+template <typename T, typename U>
+constexpr bool same_copy_traits =
+    std::is_trivially_copy_constructible_v<T> ==
+        std::is_trivially_copy_constructible_v<U> &&
+    std::is_trivially_move_constructible_v<T> ==
+        std::is_trivially_move_constructible_v<U> &&
+    std::is_trivially_copy_assignable_v<T> ==
+        std::is_trivially_copy_assignable_v<U> &&
+    std::is_trivially_move_assignable_v<T> ==
+        std::is_trivially_move_assignable_v<U> &&
+    std::is_trivially_destructible_v<T> == std::is_trivially_destructible_v<U>;
+
+struct Aggregate {
+  double x;
+  double y;
+};
+
+template <typename T>
+using all_skills = cina::new_type<
+    struct AllSkillsTag, T, cina::equality_comparison,
+    cina::three_way_comparison, cina::output_stream, cina::input_stream,
+    cina::addition, cina::subtraction, cina::multiplication, cina::division,
+    cina::modulo, cina::negation, cina::increment, cina::decrement>;
+
+template <typename T>
+using saturating = cina::new_type<struct SaturatingTag, T,
+                                  cina::addition::with<cina::saturate>,
+                                  cina::subtraction::with<cina::saturate>,
+                                  cina::multiplication::with<cina::saturate>,
+                                  cina::negation::with<cina::saturate>>;
+} // namespace
+
+TEST(TestLayout, TestStrongType) {
+  static_assert(same_layout<cina::strong_type<struct Tag, char>, char>);
+  static_assert(same_layout<cina::strong_type<struct Tag, int>, int>);
+  static_assert(
+      same_layout<cina::strong_type<struct Tag, long long>, long long>);
+  static_assert(same_layout<cina::strong_type<struct Tag, float>, float>);
+  static_assert(same_layout<cina::strong_type<struct Tag, double>, double>);
+  static_assert(same_layout<cina::strong_type<struct Tag, int*>, int*>);
+  static_assert(
+      same_layout<cina::strong_type<struct Tag, Aggregate>, Aggregate>);
+  static_assert(same_copy_traits<cina::strong_type<struct Tag, int>, int>);
+  static_assert(same_copy_traits<cina::strong_type<struct Tag, const int>,
+                                 const int>);
+  static_assert(
+      same_copy_traits<cina::strong_type<struct Tag, std::vector<int>>,
+                       std::vector<int>>);
+  static_assert(
+      !std::is_trivially_copyable_v<cina::strong_type<struct Tag, int&>>);
+}
+
+TEST(TestLayout, TestBooleanType) {
+  static_assert(same_layout<cina::boolean_type<struct Tag, bool>, bool>);
+  static_assert(same_layout<cina::new_type<struct Tag, bool>, bool>);
+  static_assert(same_copy_traits<cina::boolean_type<struct Tag, bool>, bool>);
+}
+
+TEST(TestLayout, TestSignedIntegerType) {
+  static_assert(same_layout<cina::signed_integer_type<struct Tag, std::int8_t>,
+                            std::int8_t>);
+  static_assert(
+      same_layout<cina::signed_integer_type<struct Tag, std::int16_t>,
+                  std::int16_t>);
+  static_assert(
+      same_layout<cina::signed_integer_type<struct Tag, std::int32_t>,
+                  std::int32_t>);
+  static_assert(
+      same_layout<cina::signed_integer_type<struct Tag, std::int64_t>,
+                  std::int64_t>);
+  static_assert(same_layout<cina::new_type<struct Tag, int>, int>);
+  static_assert(
+      same_copy_traits<cina::signed_integer_type<struct Tag, int>, int>);
+}
+
+TEST(TestLayout, TestRangeInteger) {
+  static_assert(
+      same_layout<cina::range_integer<struct Tag, 0, 100>, std::int8_t>);
+  static_assert(
+      same_layout<cina::range_integer<struct Tag, 0, 255>, std::uint8_t>);
+  static_assert(
+      same_layout<cina::range_integer<struct Tag, 0, 65535>, std::uint16_t>);
+  static_assert(
+      same_layout<cina::range_integer<struct Tag, -1, 70000>, std::int32_t>);
+}
+
+TEST(TestLayout, TestSkills) {
+  static_assert(same_layout<all_skills<std::int8_t>, std::int8_t>);
+  static_assert(same_layout<all_skills<std::int32_t>, std::int32_t>);
+  static_assert(same_layout<all_skills<std::int64_t>, std::int64_t>);
+  static_assert(same_layout<all_skills<double>, double>);
+  static_assert(same_layout<saturating<std::int16_t>, std::int16_t>);
+  static_assert(same_layout<saturating<std::uint32_t>, std::uint32_t>);
+}
+
+TEST(TestLayout, TestMemcpy) {
+  using strong_int = all_skills<std::int32_t>;
+  const std::vector<strong_int> source{strong_int{1}, strong_int{2},
+                                       strong_int{3}};
+  std::vector<strong_int> copy(source.size(), strong_int{0});
+  std::copy(source.begin(), source.end(), copy.begin());
+  EXPECT_EQ(copy, source);
+
+  std::int32_t raw[3]{};
+  std::memcpy(raw, source.data(), sizeof(raw));
+  EXPECT_EQ(raw[0], 1);
+  EXPECT_EQ(raw[2], 3);
+}
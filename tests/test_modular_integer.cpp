@@ -0,0 +1,135 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+using slot = cina::modular_integer<struct SlotTag, 1024>;
+using prime = cina::modular_integer<struct PrimeTag, 1'000'000'007>;
+using byte_ring = cina::modular_integer<struct ByteTag, 256>;
+using small = cina::modular_integer<struct SmallTag, 7>;
+using wide = cina::modular_integer<struct WideTag, (1ULL << 62) + 135>;
+
+TEST(TestModularInteger, TestStorage) {
+  EXPECT_TRUE((std::same_as<slot::storage_type, std::uint16_t>));
+  EXPECT_TRUE((std::same_as<byte_ring::storage_type, std::uint8_t>));
+  EXPECT_TRUE((std::same_as<prime::storage_type, std::uint32_t>));
+  EXPECT_TRUE((std::same_as<wide::storage_type, std::uintmax_t>));
+  EXPECT_EQ(sizeof(slot), sizeof(std::uint16_t));
+  EXPECT_TRUE(std::is_trivially_copyable_v<slot>);
+  EXPECT_TRUE(cina::modular_type<slot>);
+  EXPECT_TRUE(cina::integer<slot>);
+  EXPECT_FALSE((cina::modular_type<cina::new_type<struct Tag, int>>));
+  EXPECT_EQ(slot::modulus, 1024U);
+}
+
+TEST(TestModularInteger, TestConstruction) {
+  static_assert(slot{1023}.unwrap() == 1023);
+  static_assert(slot::first().unwrap() == 0);
+  static_assert(slot::last().unwrap() == 1023);
+  EXPECT_THROW(slot{1024}, cina::constraint_error);
+  EXPECT_THROW(slot{-1}, cina::constraint_error);
+
+  static_assert(slot::mod(1025).unwrap() == 1);
+  static_assert(slot::mod(-1).unwrap() == 1023);
+  static_assert(small::mod(-8).unwrap() == 6);
+  static_assert(
+      small::mod(std::numeric_limits<std::int64_t>::min()).unwrap() == 6);
+  static_assert(
+      small::mod(std::numeric_limits<std::uint64_t>::max()).unwrap() == 1);
+}
+
+TEST(TestModularInteger, TestPowerOfTwoArithmetic) {
+  static_assert((slot{1000} + slot{100}).unwrap() == 76);
+  static_assert((slot{10} - slot{20}).unwrap() == 1014);
+  static_assert((slot{1000} * slot{1000}).unwrap() == 1'000'000 % 1024);
+  static_assert((-slot{1}).unwrap() == 1023);
+  static_assert((-slot{0}).unwrap() == 0);
+  static_assert((byte_ring{255} + byte_ring{1}).unwrap() == 0);
+  static_assert((byte_ring{16} * byte_ring{16}).unwrap() == 0);
+  static_assert((slot{1000} / slot{3}).unwrap() == 333);
+  static_assert((slot{1000} % slot{3}).unwrap() == 1);
+}
+
+TEST(TestModularInteger, TestNonPowerOfTwoArithmetic) {
+  static_assert((small{5} + small{4}).unwrap() == 2);
+  static_assert((small{2} - small{5}).unwrap() == 4);
+  static_assert((small{6} * small{6}).unwrap() == 1);
+  static_assert((-small{3}).unwrap() == 4);
+
+  constexpr std::uint64_t p = 1'000'000'007;
+  static_assert((prime{999'999'999} * prime{999'999'998}).unwrap() ==
+                999'999'999ULL * 999'999'998ULL % p);
+  static_assert((prime{1'000'000'006} + prime{1'000'000'006}).unwrap() ==
+                1'000'000'005);
+
+  constexpr std::uint64_t w = (1ULL << 62) + 135;
+  static_assert((wide{w - 1} + wide{w - 1}).unwrap() == w - 2);
+  static_assert((wide{w - 1} * wide{w - 1}).unwrap() == 1);
+  static_assert((wide{0} - wide{1}).unwrap() == w - 1);
+
+  // The largest 64-bit prime exercises the 128-bit Barrett reduction.
+  using wide_prime =
+      cina::modular_integer<struct WidePrimeTag, 0xffff'ffff'ffff'ffc5ULL>;
+  constexpr std::uint64_t q = 0xffff'ffff'ffff'ffc5ULL;
+  static_assert((wide_prime{q - 1} * wide_prime{q - 1}).unwrap() == 1);
+  static_assert((wide_prime{q - 1} * wide_prime{2}).unwrap() == q - 2);
+  // 2^126 = 2^62 * 2^64 = 2^62 * 59 = 14 * 2^64 + 3 * 2^62 (mod q).
+  static_assert((wide_prime{1ULL << 63} * wide_prime{1ULL << 63}).unwrap() ==
+                (3ULL << 62) + 14 * 59);
+
+  // Exhaustive check of the Barrett reduction against %.
+  for (std::uint64_t a = 0; a < 97; ++a) {
+    for (std::uint64_t b = 0; b < 97; ++b) {
+      using m97 = cina::modular_integer<struct M97Tag, 97>;
+      EXPECT_EQ((m97{a} * m97{b}).unwrap(), a * b % 97);
+      EXPECT_EQ((m97{a} + m97{b}).unwrap(), (a + b) % 97);
+      EXPECT_EQ((m97{a} - m97{b}).unwrap(), (a + 97 - b) % 97);
+    }
+  }
+  for (std::uint64_t a = p - 1000; a < p; a += 7) {
+    EXPECT_EQ((prime{a} * prime{p - 1 - (a % 13)}).unwrap(),
+              a * (p - 1 - (a % 13)) % p);
+  }
+  // (q - a) * (q - b) = a * b and (q - a) * b = q - a * b (mod q).
+  for (std::uint64_t a = 1; a < 200; a += 3) {
+    for (std::uint64_t b = 1; b < 200; b += 5) {
+      EXPECT_EQ((wide_prime{q - a} * wide_prime{q - b}).unwrap(), a * b);
+      EXPECT_EQ((wide_prime{q - a} * wide_prime{b}).unwrap(), q - a * b);
+    }
+  }
+}
+
+TEST(TestModularInteger, TestCompoundAndIncrement) {
+  slot a{1020};
+  a += slot{10};
+  EXPECT_EQ(a.unwrap(), 6);
+  a -= slot{7};
+  EXPECT_EQ(a.unwrap(), 1023);
+  ++a;
+  EXPECT_EQ(a, slot::first());
+  --a;
+  EXPECT_EQ(a, slot::last());
+  EXPECT_EQ((a++).unwrap(), 1023);
+  EXPECT_EQ(a.unwrap(), 0);
+  a *= slot{5};
+  EXPECT_EQ(a.unwrap(), 0);
+  EXPECT_LT(slot{1}, slot{2});
+}
+
+TEST(TestModularInteger, TestStreams) {
+  std::ostringstream os;
+  os << byte_ring{200} << ' ' << slot{1000};
+  EXPECT_EQ(os.str(), "200 1000");
+
+  std::istringstream is{"42 1024"};
+  slot a{0};
+  is >> a;
+  EXPECT_EQ(a.unwrap(), 42);
+  is >> a;
+  EXPECT_TRUE(is.fail());
+  EXPECT_EQ(a.unwrap(), 42);
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <format>
+#include <functional>
+#include <sstream>
+#include <type_traits>
+
+import cina;
+
+TEST(TestModule, TestSignedIntegerType) {
+  using type = cina::new_type<struct Tag, int>;
+  EXPECT_TRUE((std::same_as<type, cina::signed_integer_type<struct Tag, int>>));
+
+  constexpr type a{40};
+  constexpr type b{2};
+  static_assert((a + b).unwrap() == 42);
+  static_assert(a > b);
+  EXPECT_EQ((a * b).unwrap(), 80);
+  EXPECT_EQ(std::hash<type>{}(a), std::hash<int>{}(40));
+  EXPECT_EQ(std::format("{:04x}", a), "0028");
+
+  std::ostringstream os;
+  os << a;
+  EXPECT_EQ(os.str(), "40");
+}
+
+TEST(TestModule, TestBooleanType) {
+  using type = cina::new_type<struct Tag, bool>;
+  EXPECT_TRUE((std::same_as<type, cina::boolean_type<struct Tag, bool>>));
+
+  const type a{true};
+  EXPECT_TRUE(static_cast<bool>(a));
+  EXPECT_EQ(std::format("{}", a), "true");
+}
+
+TEST(TestModule, TestTypeFactory) {
+  using type = cina::new_type<struct Tag, bool, cina::no_skills>;
+  EXPECT_TRUE((std::same_as<type, cina::strong_type<struct Tag, bool>>));
+  EXPECT_TRUE(cina::strong_type_like<type>);
+}
\ No newline at end of file
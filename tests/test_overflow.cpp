@@ -0,0 +1,169 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <type_traits>
+
+template <typename T, typename Policy>
+using checked_integer =
+    cina::new_type<struct OverflowTag, T, cina::addition::with<Policy>,
+                   cina::subtraction::with<Policy>,
+                   cina::multiplication::with<Policy>,
+                   cina::division::with<Policy>, cina::modulo::with<Policy>,
+                   cina::negation::with<Policy>, cina::equality_comparison>;
+
+using saturating = checked_integer<std::int16_t, cina::saturate>;
+using wrapping = checked_integer<std::int16_t, cina::wrap>;
+using trapping = checked_integer<std::int16_t, cina::trap>;
+using expected = checked_integer<std::int16_t, cina::checked_expected>;
+using saturating_unsigned = checked_integer<std::uint8_t, cina::saturate>;
+
+constexpr std::int16_t max16 = std::numeric_limits<std::int16_t>::max();
+constexpr std::int16_t min16 = std::numeric_limits<std::int16_t>::min();
+
+TEST(TestOverflow, TestResultType) {
+  EXPECT_TRUE((std::same_as<decltype(saturating{1} + saturating{1}),
+                            saturating>));
+  EXPECT_TRUE((std::same_as<decltype(-wrapping{1}), wrapping>));
+  EXPECT_TRUE((std::same_as<decltype(expected{1} * expected{1}),
+                            std::expected<expected, cina::arithmetic_error>>));
+  EXPECT_EQ(sizeof(saturating), sizeof(std::int16_t));
+}
+
+TEST(TestOverflow, TestSaturate) {
+  static_assert((saturating{max16} + saturating{1}).unwrap() == max16);
+  static_assert((saturating{min16} + saturating{-1}).unwrap() == min16);
+  static_assert((saturating{min16} - saturating{1}).unwrap() == min16);
+  static_assert((saturating{max16} - saturating{-1}).unwrap() == max16);
+  static_assert((saturating{-1} - saturating{min16}).unwrap() == max16);
+  static_assert((saturating{200} * saturating{200}).unwrap() == max16);
+  static_assert((saturating{-200} * saturating{200}).unwrap() == min16);
+  static_assert((saturating{-200} * saturating{-200}).unwrap() == max16);
+  static_assert((-saturating{min16}).unwrap() == max16);
+  static_assert((saturating{100} + saturating{-30}).unwrap() == 70);
+
+  static_assert((saturating_unsigned{250} + saturating_unsigned{10}).unwrap() ==
+                255);
+  static_assert((saturating_unsigned{5} - saturating_unsigned{10}).unwrap() ==
+                0);
+  static_assert((saturating_unsigned{16} * saturating_unsigned{16}).unwrap() ==
+                255);
+  static_assert((-saturating_unsigned{5}).unwrap() == 0);
+
+  saturating a{max16};
+  a += saturating{10};
+  EXPECT_EQ(a.unwrap(), max16);
+  a -= saturating{max16};
+  EXPECT_EQ(a.unwrap(), 0);
+  a *= saturating{3};
+  EXPECT_EQ(a.unwrap(), 0);
+}
+
+TEST(TestOverflow, TestWrap) {
+  static_assert((wrapping{max16} + wrapping{1}).unwrap() == min16);
+  static_assert((wrapping{min16} - wrapping{1}).unwrap() == max16);
+  static_assert((wrapping{256} * wrapping{256}).unwrap() == 0);
+  static_assert((-wrapping{min16}).unwrap() == min16);
+
+  wrapping a{max16};
+  a += wrapping{2};
+  EXPECT_EQ(a.unwrap(), min16 + 1);
+}
+
+TEST(TestOverflow, TestCheckedExpected) {
+  const auto ok = expected{20} + expected{22};
+  ASSERT_TRUE(ok.has_value());
+  EXPECT_EQ(ok->unwrap(), 42);
+
+  const auto overflow = expected{max16} + expected{1};
+  ASSERT_FALSE(overflow.has_value());
+  EXPECT_EQ(overflow.error(), cina::arithmetic_error::overflow);
+  EXPECT_FALSE((expected{min16} - expected{1}).has_value());
+  EXPECT_FALSE((expected{300} * expected{300}).has_value());
+  EXPECT_FALSE((-expected{min16}).has_value());
+  EXPECT_EQ((-expected{5})->unwrap(), -5);
+
+  EXPECT_FALSE(
+      (std::is_invocable_v<decltype([](auto& a, auto b) -> decltype(a += b) {
+                             return a += b;
+                           }),
+                           expected&, expected>));
+  EXPECT_TRUE(
+      (std::is_invocable_v<decltype([](auto& a, auto b) -> decltype(a += b) {
+                             return a += b;
+                           }),
+                           saturating&, saturating>));
+}
+
+TEST(TestOverflow, TestTrap) {
+  static_assert((trapping{20} + trapping{22}).unwrap() == 42);
+  const trapping max{max16};
+  const trapping min{min16};
+  const trapping one{1};
+  EXPECT_DEATH((void)(max + one), "");
+  EXPECT_DEATH((void)(min * -one), "");
+}
+
+TEST(TestOverflow, TestDivisionModulo) {
+  static_assert((saturating{min16} / saturating{-1}).unwrap() == max16);
+  static_assert((wrapping{min16} / wrapping{-1}).unwrap() == min16);
+  static_assert((saturating{-7} / saturating{2}).unwrap() == -3);
+  static_assert((saturating{min16} % saturating{-1}).unwrap() == 0);
+  static_assert((wrapping{-7} % wrapping{2}).unwrap() == -1);
+  static_assert((saturating_unsigned{255} / saturating_unsigned{2}).unwrap() ==
+                127);
+  static_assert((saturating_unsigned{255} % saturating_unsigned{7}).unwrap() ==
+                3);
+
+  EXPECT_FALSE((expected{min16} / expected{-1}).has_value());
+  EXPECT_EQ((expected{min16} % expected{-1})->unwrap(), 0);
+
+  saturating a{min16};
+  a /= saturating{-1};
+  EXPECT_EQ(a.unwrap(), max16);
+  a %= saturating{10};
+  EXPECT_EQ(a.unwrap(), max16 % 10);
+}
+
+template <typename T, typename Policy>
+using narrow_integer =
+    cina::new_type<struct NarrowTag, T, cina::preserve_width<Policy>,
+                   cina::equality_comparison>;
+
+TEST(TestOverflow, TestPreserveWidth) {
+  using byte = narrow_integer<std::int8_t, cina::wrap>;
+  using sample = narrow_integer<std::int16_t, cina::saturate>;
+  EXPECT_EQ(sizeof(byte), sizeof(std::int8_t));
+  EXPECT_EQ(sizeof(sample), sizeof(std::int16_t));
+  EXPECT_TRUE((std::same_as<decltype(byte{1} + byte{1}), byte>));
+  EXPECT_TRUE((std::same_as<decltype(byte{1} - byte{1}), byte>));
+  EXPECT_TRUE((std::same_as<decltype(byte{1} * byte{1}), byte>));
+  EXPECT_TRUE((std::same_as<decltype(byte{1} / byte{1}), byte>));
+  EXPECT_TRUE((std::same_as<decltype(byte{1} % byte{1}), byte>));
+  EXPECT_TRUE((std::same_as<decltype(-byte{1}), byte>));
+
+  // The default skills promote, as the built-in operators do.
+  using promoting = cina::new_type<struct NarrowTag, std::int8_t>;
+  const promoting one{std::int8_t{1}};
+  EXPECT_TRUE((std::same_as<decltype(one + one), promoting::rebind<int>>));
+
+  static_assert((byte{100} + byte{100}).unwrap() == -56);
+  static_assert((byte{16} * byte{16}).unwrap() == 0);
+  static_assert((sample{30'000} + sample{30'000}).unwrap() == 32'767);
+  static_assert((sample{-300} * sample{300}).unwrap() == -32'768);
+  static_assert((sample{-32'768} / sample{-1}).unwrap() == 32'767);
+
+  using word = narrow_integer<std::uint16_t, cina::saturate>;
+  static_assert((word{65'535} * word{65'535}).unwrap() == 65'535);
+  static_assert((word{255} * word{257}).unwrap() == 65'535);
+  static_assert((word{3} - word{5}).unwrap() == 0);
+
+  sample s{100};
+  s *= sample{1000};
+  EXPECT_EQ(s, sample{32'767});
+  s -= sample{32'767};
+  EXPECT_EQ(s, sample{0});
+}
@@ -0,0 +1,156 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <cstdint>
+#include <ratio>
+#include <sstream>
+#include <type_traits>
+
+namespace dim = cina::dimensions;
+
+using metres = cina::quantity<dim::length>;
+using kilometres = cina::quantity<dim::length, std::kilo>;
+using millimetres = cina::quantity<dim::length, std::milli, std::int64_t>;
+using whole_metres = cina::quantity<dim::length, std::ratio<1>, std::int64_t>;
+using seconds = cina::quantity<dim::time>;
+using minutes = cina::quantity<dim::time, std::ratio<60>>;
+using hours = cina::quantity<dim::time, std::ratio<3600>>;
+using metres_per_second = cina::quantity<dim::velocity>;
+// 1000 / 3600 m/s in lowest terms.
+using kilometres_per_hour = cina::quantity<dim::velocity, std::ratio<5, 18>>;
+using kilograms = cina::quantity<dim::mass, std::ratio<1>, float>;
+
+template <typename Ratio>
+concept velocity_unit =
+    requires { typename cina::quantity<dim::velocity, Ratio>; };
+
+TEST(TestQuantity, TestProperties) {
+  EXPECT_EQ(sizeof(metres), sizeof(double));
+  EXPECT_EQ(sizeof(kilograms), sizeof(float));
+  EXPECT_TRUE(std::is_trivially_copyable_v<metres>);
+  EXPECT_FALSE((std::is_convertible_v<double, metres>));
+  EXPECT_FALSE((std::is_convertible_v<metres, double>));
+  EXPECT_FALSE((std::is_constructible_v<metres, seconds>));
+  EXPECT_TRUE((std::same_as<kilometres::ratio, std::kilo>));
+  EXPECT_TRUE((std::same_as<kilometres::dimension_type, dim::length>));
+  EXPECT_TRUE(
+      (std::same_as<metres::rebind<float>,
+                    cina::quantity<dim::length, std::ratio<1>, float>>));
+  EXPECT_TRUE((std::three_way_comparable<metres, std::partial_ordering>));
+  EXPECT_TRUE((velocity_unit<std::ratio<5, 18>>));
+  EXPECT_FALSE((velocity_unit<std::ratio<1000, 3600>>));
+}
+
+TEST(TestQuantity, TestConversion) {
+  static_assert(metres{kilometres{1.5}}.unwrap() == 1500.0);
+  static_assert(kilometres{metres{250.0}}.unwrap() == 0.25);
+  static_assert(millimetres{whole_metres{3}}.unwrap() == 3000);
+  static_assert(seconds{hours{2.0}}.unwrap() == 7200.0);
+
+  // Lossless conversions are implicit, others are explicit.
+  EXPECT_TRUE((std::is_convertible_v<kilometres, metres>));
+  EXPECT_TRUE((std::is_convertible_v<whole_metres, millimetres>));
+  EXPECT_TRUE((std::is_convertible_v<whole_metres, metres>));
+  EXPECT_FALSE((std::is_convertible_v<millimetres, whole_metres>));
+  EXPECT_FALSE((std::is_convertible_v<metres, whole_metres>));
+  EXPECT_TRUE((std::is_constructible_v<whole_metres, millimetres>));
+
+  static_assert(cina::quantity_cast<whole_metres>(millimetres{2999})
+                    .unwrap() == 2);
+  static_assert(cina::quantity_cast<whole_metres>(metres{7.9}).unwrap() == 7);
+  static_assert(cina::quantity_cast<metres_per_second>(
+                    kilometres_per_hour{36.0})
+                    .unwrap() == 10.0);
+}
+
+TEST(TestQuantity, TestArithmetic) {
+  constexpr metres a{3.0};
+  constexpr metres b{4.5};
+  static_assert((a + b).unwrap() == 7.5);
+  static_assert((a - b).unwrap() == -1.5);
+  static_assert((-a).unwrap() == -3.0);
+  static_assert((a * 2.0).unwrap() == 6.0);
+  static_assert((2.0 * a).unwrap() == 6.0);
+  static_assert((b / 3.0).unwrap() == 1.5);
+  static_assert(a < b);
+  static_assert(a == metres{3.0});
+
+  metres c{1.0};
+  c += a;
+  EXPECT_EQ(c, metres{4.0});
+  c -= b;
+  EXPECT_EQ(c, metres{-0.5});
+  c *= 4.0;
+  EXPECT_EQ(c, metres{-2.0});
+  c /= -2.0;
+  EXPECT_EQ(c, metres{1.0});
+}
+
+TEST(TestQuantity, TestMixedUnits) {
+  // Mixed units are computed in the common unit, like std::chrono::duration.
+  constexpr auto sum = kilometres{1.0} + metres{1.0};
+  static_assert(std::same_as<std::remove_const_t<decltype(sum)>, metres>);
+  static_assert(sum.unwrap() == 1001.0);
+  static_assert((metres{1.0} + kilometres{1.0}).unwrap() == 1001.0);
+  static_assert((kilometres{1.0} - metres{250.0}).unwrap() == 750.0);
+
+  constexpr auto total = whole_metres{2} + millimetres{5};
+  static_assert(std::same_as<std::remove_const_t<decltype(total)>,
+                             millimetres>);
+  static_assert(total.unwrap() == 2005);
+
+  // The common unit of hours and minutes is the largest unit dividing
+  // both.
+  constexpr auto elapsed = hours{1.0} + minutes{30.0};
+  static_assert(std::same_as<std::remove_const_t<decltype(elapsed)>, minutes>);
+  static_assert(elapsed.unwrap() == 90.0);
+  static_assert(std::same_as<decltype(kilometres{1.0} + millimetres{1}),
+                             cina::quantity<dim::length, std::milli>>);
+
+  static_assert(kilometres{1.0} == metres{1000.0});
+  static_assert(metres{1000.0} == kilometres{1.0});
+  static_assert(kilometres{1.0} != metres{999.0});
+  static_assert(metres{999.0} < kilometres{1.0});
+  static_assert(kilometres{1.0} > metres{999.0});
+  static_assert(whole_metres{1} == millimetres{1000});
+  static_assert(millimetres{999} < whole_metres{1});
+  static_assert((kilometres{1.0} <=> metres{1000.0}) == 0);
+}
+
+TEST(TestQuantity, TestDerivedDimensions) {
+  constexpr auto speed = metres{100.0} / seconds{8.0};
+  static_assert(std::same_as<std::remove_const_t<decltype(speed)>,
+                             metres_per_second>);
+  static_assert(speed.unwrap() == 12.5);
+
+  constexpr auto area = metres{3.0} * metres{4.0};
+  static_assert(std::same_as<decltype(area)::dimension_type,
+                             dim::area>);
+  static_assert(area.unwrap() == 12.0);
+
+  constexpr auto ratio = metres{6.0} / metres{3.0};
+  static_assert(std::same_as<decltype(ratio)::dimension_type,
+                             dim::dimensionless>);
+  static_assert(ratio.unwrap() == 2.0);
+
+  // The units multiply as well: km / h is 1000 / 3600 m/s.
+  constexpr auto pace = kilometres{72.0} / hours{2.0};
+  static_assert(std::same_as<std::remove_const_t<decltype(pace)>,
+                             kilometres_per_hour>);
+  static_assert(metres_per_second{pace}.unwrap() == 10.0);
+
+  constexpr auto force =
+      kilograms{2.0F} * (metres_per_second{6.0} / seconds{3.0});
+  static_assert(std::same_as<decltype(force)::dimension_type,
+                             dim::force>);
+  static_assert(std::same_as<decltype(force)::rep, double>);
+  static_assert(force.unwrap() == 4.0);
+}
+
+TEST(TestQuantity, TestStreams) {
+  std::ostringstream os;
+  os << metres{2.5} << ' ' << millimetres{-7};
+  EXPECT_EQ(os.str(), "2.5 -7");
+}
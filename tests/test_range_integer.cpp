@@ -0,0 +1,143 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+
+using percent = cina::range_integer<struct PercentTag, 0, 100>;
+using port = cina::range_integer<struct PortTag, 0, 65535>;
+using priority = cina::range_integer<struct PriorityTag, -20, 19>;
+
+TEST(TestRangeInteger, TestStorage) {
+  EXPECT_TRUE((std::same_as<percent::storage_type, std::int8_t>));
+  EXPECT_TRUE((std::same_as<port::storage_type, std::uint16_t>));
+  EXPECT_TRUE((std::same_as<priority::storage_type, std::int8_t>));
+  EXPECT_TRUE((std::same_as<cina::range_integer<struct Tag, 0, 255>::storage_type,
+                            std::uint8_t>));
+  EXPECT_TRUE(
+      (std::same_as<cina::range_integer<struct Tag, -1, 255>::storage_type,
+                    std::int16_t>));
+  EXPECT_TRUE(
+      (std::same_as<cina::range_integer<struct Tag, 0, 70000>::storage_type,
+                    std::int32_t>));
+  EXPECT_TRUE(
+      (std::same_as<cina::range_integer<struct Tag, 0, 4'000'000'000>::storage_type,
+                    std::intmax_t>));
+
+  EXPECT_EQ(sizeof(percent), sizeof(std::int8_t));
+  EXPECT_EQ(sizeof(port), sizeof(std::uint16_t));
+  EXPECT_TRUE(std::is_trivially_copyable_v<percent>);
+  EXPECT_FALSE((std::is_constructible_v<percent, priority>));
+}
+
+TEST(TestRangeInteger, TestCXXProperties) {
+  EXPECT_FALSE(std::is_default_constructible_v<percent>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<percent>);
+  EXPECT_TRUE(std::is_trivially_destructible_v<percent>);
+  EXPECT_TRUE(std::is_nothrow_move_constructible_v<percent>);
+  EXPECT_FALSE((std::convertible_to<percent, int>));
+  EXPECT_TRUE(std::swappable<percent>);
+  EXPECT_TRUE((std::three_way_comparable<percent, std::strong_ordering>));
+  EXPECT_TRUE(cina::integer<percent>);
+  EXPECT_TRUE(cina::range_constrained_integer<percent>);
+  EXPECT_FALSE(
+      (cina::range_constrained_integer<cina::new_type<struct Tag, int>>));
+}
+
+TEST(TestRangeInteger, TestConstructor) {
+  constexpr percent a{42};
+  static_assert(a.unwrap() == 42);
+  constexpr port b{65535U};
+  static_assert(b.unwrap() == 65535);
+  static_assert(percent::first().unwrap() == 0);
+  static_assert(percent::last().unwrap() == 100);
+  static_assert(priority::first().unwrap() == -20);
+
+  EXPECT_THROW(percent{101}, cina::constraint_error);
+  EXPECT_THROW(percent{-1}, cina::constraint_error);
+  EXPECT_THROW(port{-1LL}, cina::constraint_error);
+  EXPECT_THROW(port{65536}, cina::constraint_error);
+  EXPECT_NO_THROW(priority{-20});
+
+  using base = percent::base_integer_type;
+  EXPECT_EQ(percent{base{7}}.unwrap(), 7);
+  EXPECT_THROW(percent{base{200}}, cina::constraint_error);
+}
+
+TEST(TestRangeInteger, TestComparison) {
+  constexpr percent a{10};
+  constexpr percent b{20};
+  static_assert(a == a);
+  static_assert(a != b);
+  static_assert(a < b);
+  static_assert(b >= a);
+  EXPECT_LT(a, b);
+  EXPECT_EQ(a <=> b, std::strong_ordering::less);
+}
+
+TEST(TestRangeInteger, TestArithmetic) {
+  constexpr percent a{60};
+  constexpr percent b{50};
+  using base = percent::base_integer_type;
+  EXPECT_TRUE((std::same_as<decltype(a + b), base>));
+  EXPECT_TRUE((std::same_as<base, cina::signed_integer_type<PercentTag, int>>));
+  static_assert((a + b).unwrap() == 110);
+  static_assert((b - a).unwrap() == -10);
+  static_assert((a * b).unwrap() == 3000);
+  static_assert((a / b).unwrap() == 1);
+  static_assert((a % b).unwrap() == 10);
+  static_assert((-a).unwrap() == -60);
+
+  percent c{a};
+  EXPECT_THROW(c += b, cina::constraint_error);
+  EXPECT_EQ(c.unwrap(), 60);
+  c -= b;
+  EXPECT_EQ(c.unwrap(), 10);
+  c *= percent{5};
+  EXPECT_EQ(c.unwrap(), 50);
+  c /= percent{2};
+  EXPECT_EQ(c.unwrap(), 25);
+  c %= percent{7};
+  EXPECT_EQ(c.unwrap(), 4);
+  EXPECT_THROW(c -= b, cina::constraint_error);
+
+  port p{65535};
+  EXPECT_EQ((p + p).unwrap(), 131070);
+}
+
+TEST(TestRangeInteger, TestIncrementDecrement) {
+  percent a{99};
+  ++a;
+  EXPECT_EQ(a, percent::last());
+  EXPECT_THROW(++a, cina::constraint_error);
+  EXPECT_EQ(a, percent::last());
+  EXPECT_EQ((a--).unwrap(), 100);
+  EXPECT_EQ(a.unwrap(), 99);
+
+  percent b = percent::first();
+  EXPECT_THROW(--b, cina::constraint_error);
+  EXPECT_EQ((b++).unwrap(), 0);
+  EXPECT_EQ(b.unwrap(), 1);
+}
+
+TEST(TestRangeInteger, TestStreams) {
+  std::ostringstream os;
+  os << percent{42} << ' ' << port{8080} << ' ' << priority{-5};
+  EXPECT_EQ(os.str(), "42 8080 -5");
+
+  std::istringstream is{"75 101"};
+  percent a{0};
+  is >> a;
+  EXPECT_EQ(a.unwrap(), 75);
+  is >> a;
+  EXPECT_TRUE(is.fail());
+  EXPECT_EQ(a.unwrap(), 75);
+}
+
+TEST(TestRangeInteger, TestHash) {
+  std::hash<percent> hasher;
+  EXPECT_EQ(hasher(percent{42}), std::hash<std::int8_t>{}(42));
+}
\ No newline at end of file
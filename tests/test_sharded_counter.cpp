@@ -0,0 +1,85 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using requests = cina::new_type<struct RequestsTag, std::int64_t>;
+using small = cina::new_type<struct SmallTag, std::int8_t>;
+using level = cina::new_type<struct LevelTag, std::int32_t,
+                             cina::addition::with<cina::saturate>>;
+using ratio = cina::new_type<struct RatioTag, double>;
+
+namespace {
+template <typename T>
+concept shardable = requires { typename cina::sharded_counter<T>; };
+} // namespace
+
+TEST(TestShardedCounter, TestLayout) {
+  EXPECT_EQ(alignof(cina::cache_aligned<char>), cina::cache_line_size);
+  EXPECT_EQ(sizeof(cina::cache_aligned<char>), cina::cache_line_size);
+  EXPECT_EQ(sizeof(cina::cache_aligned<char[cina::cache_line_size + 1]>),
+            2 * cina::cache_line_size);
+  EXPECT_EQ(sizeof(cina::sharded_counter<requests, 8>),
+            8 * cina::cache_line_size);
+  EXPECT_FALSE(
+      std::is_copy_constructible_v<cina::sharded_counter<requests>>);
+
+  cina::cache_aligned<requests> aligned{requests{3}};
+  EXPECT_EQ(aligned.value, requests{3});
+}
+
+TEST(TestShardedCounter, TestConstraints) {
+  EXPECT_TRUE(shardable<requests>);
+  EXPECT_TRUE(shardable<small>);
+  EXPECT_FALSE(shardable<level>);
+  EXPECT_FALSE(shardable<ratio>);
+  EXPECT_FALSE(shardable<std::int64_t>);
+}
+
+TEST(TestShardedCounter, TestOperations) {
+  cina::sharded_counter<requests> counter;
+  EXPECT_EQ(counter.load(), requests{0});
+  counter.increment();
+  counter.add(requests{10});
+  counter.decrement();
+  counter.subtract(requests{3});
+  EXPECT_EQ(counter.load(), requests{7});
+  counter.reset();
+  EXPECT_EQ(counter.load(), requests{0});
+}
+
+TEST(TestShardedCounter, TestWrapAround) {
+  constexpr std::int8_t max = std::numeric_limits<std::int8_t>::max();
+  cina::sharded_counter<small, 4> counter;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&counter] { counter.add(small{max}); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.load(), small{std::int8_t{-4}});
+}
+
+TEST(TestShardedCounter, TestConcurrentIncrement) {
+  constexpr int thread_count = 8;
+  constexpr int increments = 10'000;
+  cina::sharded_counter<requests, 4> counter;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&counter] {
+      for (int i = 0; i < increments; ++i) {
+        counter.increment();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.load(), requests{thread_count * increments});
+}
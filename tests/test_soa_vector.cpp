@@ -0,0 +1,128 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+using order_id = cina::new_type<struct OrderIdTag, std::int32_t>;
+using price = cina::new_type<struct PriceTag, std::int64_t>;
+using quantity = cina::new_type<struct QuantityTag, std::int16_t>;
+using symbol = cina::new_type<struct SymbolTag, std::string>;
+
+using orders = cina::soa_vector<order_id, price, quantity>;
+
+namespace {
+template <typename... Fields>
+concept valid_soa = requires { typename cina::soa_vector<Fields...>; };
+
+auto make_orders() -> orders {
+  orders result;
+  result.push_back(order_id{1}, price{300}, quantity{std::int16_t{5}});
+  result.push_back(order_id{2}, price{100}, quantity{std::int16_t{7}});
+  result.push_back(order_id{3}, price{200}, quantity{std::int16_t{5}});
+  result.push_back(order_id{4}, price{100}, quantity{std::int16_t{1}});
+  return result;
+}
+} // namespace
+
+TEST(TestSoaVector, TestTypes) {
+  EXPECT_TRUE((valid_soa<order_id, price>));
+  EXPECT_FALSE((valid_soa<order_id, order_id>));
+  EXPECT_FALSE((valid_soa<std::int32_t>));
+  EXPECT_FALSE((valid_soa<>));
+  EXPECT_TRUE((std::same_as<decltype(std::declval<orders&>().column<price>()),
+                            std::span<price>>));
+  EXPECT_TRUE(
+      (std::same_as<decltype(std::declval<const orders&>().column<price>()),
+                    std::span<const price>>));
+  EXPECT_TRUE((std::same_as<orders::reference,
+                            std::tuple<order_id&, price&, quantity&>>));
+}
+
+TEST(TestSoaVector, TestPushBack) {
+  orders table;
+  EXPECT_TRUE(table.empty());
+  table.reserve(4);
+  table.push_back(order_id{1}, price{10}, quantity{std::int16_t{2}});
+  table.push_back(
+      std::tuple{order_id{2}, price{20}, quantity{std::int16_t{4}}});
+  EXPECT_EQ(table.size(), 2U);
+
+  const std::span<const price> prices = std::as_const(table).column<price>();
+  ASSERT_EQ(prices.size(), 2U);
+  EXPECT_EQ(prices[0], price{10});
+  EXPECT_EQ(prices[1], price{20});
+  EXPECT_EQ(table.column<order_id>().data() + 1,
+            &std::get<order_id&>(table[1]));
+
+  table.pop_back();
+  EXPECT_EQ(table.size(), 1U);
+  table.clear();
+  EXPECT_TRUE(table.empty());
+}
+
+TEST(TestSoaVector, TestRows) {
+  orders table = make_orders();
+  const auto [id, cost, amount] = table[1];
+  EXPECT_EQ(id, order_id{2});
+  EXPECT_EQ(cost, price{100});
+  EXPECT_EQ(amount, quantity{std::int16_t{7}});
+
+  table[1] = std::tuple{order_id{9}, price{900}, quantity{std::int16_t{9}}};
+  std::get<price&>(table[2]) = price{222};
+  EXPECT_EQ(table.column<order_id>()[1], order_id{9});
+  EXPECT_EQ(table.column<price>()[2], price{222});
+
+  const orders& view = table;
+  EXPECT_EQ(std::get<const price&>(view.at(1)), price{900});
+  EXPECT_THROW(static_cast<void>(view.at(4)), std::out_of_range);
+}
+
+TEST(TestSoaVector, TestErase) {
+  orders table = make_orders();
+  table.erase(1);
+  ASSERT_EQ(table.size(), 3U);
+  EXPECT_EQ(table.column<order_id>()[1], order_id{3});
+  EXPECT_EQ(table.column<price>()[1], price{200});
+  EXPECT_EQ(table.column<quantity>()[2], quantity{std::int16_t{1}});
+}
+
+TEST(TestSoaVector, TestSortBy) {
+  orders table = make_orders();
+  table.sort_by<price>();
+  const std::span<const order_id> ids = table.column<order_id>();
+  EXPECT_EQ(ids[0], order_id{2});
+  EXPECT_EQ(ids[1], order_id{4});
+  EXPECT_EQ(ids[2], order_id{3});
+  EXPECT_EQ(ids[3], order_id{1});
+  EXPECT_EQ(table.column<quantity>()[0], quantity{std::int16_t{7}});
+
+  table.sort_by<quantity>(std::greater<>{});
+  EXPECT_EQ(table.column<order_id>()[0], order_id{2});
+  // Equal quantities keep the price order of the previous sort.
+  EXPECT_EQ(table.column<order_id>()[1], order_id{3});
+  EXPECT_EQ(table.column<order_id>()[2], order_id{1});
+  EXPECT_EQ(table.column<order_id>()[3], order_id{4});
+}
+
+TEST(TestSoaVector, TestComparison) {
+  orders a = make_orders();
+  orders b = make_orders();
+  EXPECT_EQ(a, b);
+  b.column<price>()[0] = price{1};
+  EXPECT_NE(a, b);
+  swap(a, b);
+  EXPECT_EQ(a.column<price>()[0], price{1});
+
+  cina::soa_vector<symbol, order_id> named;
+  named.push_back(symbol{"ABC"}, order_id{1});
+  named.push_back(symbol{"ABD"}, order_id{0});
+  named.sort_by<order_id>();
+  EXPECT_EQ(named.column<symbol>()[0], symbol{"ABD"});
+}
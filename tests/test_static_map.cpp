@@ -0,0 +1,97 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+using route_id = cina::new_type<struct RouteTag, std::uint32_t>;
+using handler_id = cina::new_type<struct HandlerTag, std::int32_t>;
+
+enum class method : std::uint8_t { get, put, post };
+using strong_method =
+    cina::new_type<struct MethodTag, method, cina::equality_comparison>;
+
+using routes =
+    cina::static_map<route_id, handler_id,
+                     cina::map_entry{route_id{80U}, handler_id{1}},
+                     cina::map_entry{route_id{443U}, handler_id{2}},
+                     cina::map_entry{route_id{8080U}, handler_id{3}},
+                     cina::map_entry{route_id{8443U}, handler_id{4}},
+                     cina::map_entry{route_id{0U}, handler_id{5}}>;
+
+template <typename T>
+concept lookup_compiles = requires(T key) { routes::find(key); };
+
+// Instantiating round_trip fails to compile unless the type of Value is
+// structural.
+template <auto Value> constexpr auto round_trip = Value;
+
+template <template <typename, typename> typename Type, typename... Ts>
+constexpr auto all_structural() -> bool {
+  return ((round_trip<Type<struct Tag, Ts>{Ts{1}}>.unwrap() == Ts{1}) && ...);
+}
+
+TEST(TestStaticMap, TestStructural) {
+  static_assert(all_structural<cina::strong_type, int, double, char>());
+  static_assert(all_structural<cina::boolean_type, bool>());
+  static_assert(all_structural<cina::signed_integer_type, std::int8_t,
+                               std::int16_t, std::int32_t, std::int64_t>());
+  static_assert(all_structural<cina::unsigned_integer_type, std::uint8_t,
+                               std::uint16_t, std::uint32_t, std::uint64_t>());
+  static_assert(round_trip<strong_method{method::put}>.unwrap() == method::put);
+  static_assert(
+      round_trip<cina::map_entry{route_id{1U}, handler_id{2}}>.value ==
+      handler_id{2});
+}
+
+TEST(TestStaticMap, TestLookup) {
+  static_assert(routes::size() == 5);
+  static_assert(routes::contains(route_id{443U}));
+  static_assert(!routes::contains(route_id{444U}));
+  static_assert(routes::value_or(route_id{8080U}, handler_id{0}) ==
+                handler_id{3});
+  static_assert(routes::value_or(route_id{1U}, handler_id{-1}) ==
+                handler_id{-1});
+  static_assert(*routes::find(route_id{0U}) == handler_id{5});
+  static_assert(routes::find(route_id{65535U}) == nullptr);
+
+  // The hashes of 65336 and 81207 agree in their low 32 bits. The hash is
+  // kept at 64 bits on every target, so the missing key is not mistaken for
+  // the present one.
+  using colliding = cina::static_map<
+      route_id, handler_id, cina::map_entry{route_id{65336U}, handler_id{1}}>;
+  static_assert(colliding::contains(route_id{65336U}));
+  static_assert(!colliding::contains(route_id{81207U}));
+
+  EXPECT_TRUE((std::same_as<routes::key_type, route_id>));
+  EXPECT_TRUE((std::same_as<routes::mapped_type, handler_id>));
+  EXPECT_TRUE(lookup_compiles<route_id>);
+  EXPECT_FALSE(lookup_compiles<handler_id>);
+  EXPECT_FALSE(lookup_compiles<std::uint32_t>);
+
+  for (std::uint32_t raw = 0; raw <= 0xffff; ++raw) {
+    const route_id key{raw};
+    const bool known =
+        raw == 80 || raw == 443 || raw == 8080 || raw == 8443 || raw == 0;
+    ASSERT_EQ(routes::contains(key), known) << raw;
+  }
+}
+
+TEST(TestStaticMap, TestOrder) {
+  ASSERT_EQ(routes::keys().size(), 5U);
+  EXPECT_EQ(routes::keys()[2], route_id{8080U});
+  EXPECT_EQ(routes::values()[4], handler_id{5});
+  for (std::size_t i = 0; i < routes::size(); ++i) {
+    EXPECT_EQ(*routes::find(routes::keys()[i]), routes::values()[i]);
+  }
+}
+
+TEST(TestStaticMap, TestEnumerationKeys) {
+  using names = cina::static_map<
+      strong_method, char, cina::map_entry{strong_method{method::get}, 'G'},
+      cina::map_entry{strong_method{method::post}, 'P'}>;
+  static_assert(names::value_or(strong_method{method::get}, '?') == 'G');
+  static_assert(names::value_or(strong_method{method::put}, '?') == '?');
+  static_assert(names::value_or(strong_method{method::post}, '?') == 'P');
+}
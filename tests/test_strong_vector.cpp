@@ -0,0 +1,101 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using row = cina::new_type<struct RowTag, std::int32_t>;
+using column = cina::new_type<struct ColumnTag, std::int32_t>;
+using wide_row = cina::new_type<struct WideRowTag, std::int64_t>;
+
+namespace {
+template <typename V, typename I>
+constexpr bool indexable_by = requires(V v, I i) { v[i]; };
+} // namespace
+
+TEST(TestStrongVector, TestTypes) {
+  using vector = cina::strong_vector<row, double>;
+  EXPECT_TRUE((std::same_as<vector::size_type, std::uint32_t>));
+  EXPECT_TRUE((std::same_as<cina::strong_vector<wide_row, double>::size_type,
+                            std::uint64_t>));
+  EXPECT_TRUE((indexable_by<vector, row>));
+  EXPECT_FALSE((indexable_by<vector, column>));
+  EXPECT_FALSE((indexable_by<vector, int>));
+  EXPECT_FALSE((indexable_by<vector, std::size_t>));
+  EXPECT_TRUE(std::ranges::contiguous_range<vector>);
+  EXPECT_TRUE(std::random_access_iterator<cina::index_range<row>::iterator>);
+  // Dereferencing yields a prvalue, so the legacy category is input only.
+  using row_iterator = cina::index_range<row>::iterator;
+  EXPECT_TRUE(
+      (std::same_as<std::iterator_traits<row_iterator>::iterator_category,
+                    std::input_iterator_tag>));
+  EXPECT_TRUE(std::ranges::random_access_range<cina::index_range<row>>);
+}
+
+TEST(TestStrongVector, TestElementAccess) {
+  cina::strong_vector<row, int> values{10, 20, 30};
+  EXPECT_EQ(values.size(), 3U);
+  EXPECT_EQ(values[row{0}], 10);
+  EXPECT_EQ(values[row{2}], 30);
+  values[row{1}] = 25;
+  EXPECT_EQ(values.at(row{1}), 25);
+  EXPECT_THROW((void)values.at(row{3}), std::out_of_range);
+  EXPECT_THROW((void)values.at(row{-1}), std::out_of_range);
+  EXPECT_EQ(values.front(), 10);
+  EXPECT_EQ(values.back(), 30);
+  EXPECT_EQ(values.end_index(), row{3});
+}
+
+TEST(TestStrongVector, TestModifiers) {
+  cina::strong_vector<row, int> values;
+  EXPECT_TRUE(values.empty());
+  values.reserve(4);
+  EXPECT_GE(values.capacity(), 4U);
+  values.push_back(1);
+  values.emplace_back(2);
+  EXPECT_EQ(values.size(), 2U);
+  values.resize(4, 7);
+  EXPECT_EQ(values[row{3}], 7);
+  values.pop_back();
+  EXPECT_EQ(values.size(), 3U);
+
+  cina::strong_vector<row, int> other(2U, 5);
+  swap(values, other);
+  EXPECT_EQ(values.size(), 2U);
+  EXPECT_EQ(other, (cina::strong_vector<row, int>{1, 2, 7}));
+  EXPECT_LT(other, values);
+  values.clear();
+  EXPECT_TRUE(values.empty());
+}
+
+TEST(TestStrongVector, TestIndices) {
+  cina::strong_vector<row, int> values(5U);
+  for (const row i : values.indices()) {
+    values[i] = i.unwrap() * 2;
+  }
+  EXPECT_EQ(values, (cina::strong_vector<row, int>{0, 2, 4, 6, 8}));
+  EXPECT_EQ(values.indices().size(), 5U);
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 20);
+
+  const cina::index_range<row> range{row{2}, row{5}};
+  EXPECT_EQ(*range.begin(), row{2});
+  EXPECT_EQ(range.begin()[2], row{4});
+  EXPECT_EQ(range.end() - range.begin(), 3);
+  std::vector<row> collected(range.begin(), range.end());
+  EXPECT_EQ(collected, (std::vector<row>{row{2}, row{3}, row{4}}));
+  EXPECT_TRUE((cina::index_range<row>{row{1}, row{1}}.empty()));
+}
+
+#ifndef NDEBUG
+TEST(TestStrongVectorDeathTest, TestBoundsAssertion) {
+  cina::strong_vector<row, int> values{1, 2, 3};
+  EXPECT_DEATH((void)values[row{3}], "out of range");
+}
+#endif
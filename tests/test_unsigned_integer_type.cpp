@@ -0,0 +1,137 @@
+#include <cina.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST(TestUnsignedIntegerType, TestTypeFactory) {
+  using type = cina::new_type<struct Tag, unsigned>;
+  EXPECT_TRUE(
+      (std::same_as<type, cina::unsigned_integer_type<struct Tag, unsigned>>));
+
+  using type2 = cina::new_type<struct Tag2, const std::uint8_t&>;
+  EXPECT_TRUE((std::same_as<type2, cina::unsigned_integer_type<
+                                       struct Tag2, const std::uint8_t&>>));
+
+  EXPECT_TRUE(cina::unsigned_integer<type>);
+  EXPECT_TRUE(cina::integer<type>);
+  EXPECT_FALSE(cina::signed_integer<type>);
+  EXPECT_FALSE((cina::unsigned_integer<cina::new_type<struct Tag3, int>>));
+  EXPECT_FALSE(cina::cxx_mathematical_unsigned_integer<bool>);
+  EXPECT_FALSE(cina::cxx_mathematical_unsigned_integer<char8_t>);
+  EXPECT_FALSE(cina::cxx_mathematical_unsigned_integer<char32_t>);
+  EXPECT_TRUE(cina::cxx_mathematical_unsigned_integer<const unsigned long&>);
+}
+
+TEST(TestUnsignedIntegerType, TestCXXProperties) {
+  using type = cina::new_type<struct Tag, std::uint32_t>;
+  EXPECT_FALSE(std::is_default_constructible_v<type>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<type>);
+  EXPECT_EQ(sizeof(type), sizeof(std::uint32_t));
+  EXPECT_EQ(alignof(type), alignof(std::uint32_t));
+  EXPECT_FALSE((std::convertible_to<type, std::uint32_t>));
+  EXPECT_TRUE(std::swappable<type>);
+  EXPECT_TRUE((std::three_way_comparable<type, std::strong_ordering>));
+}
+
+TEST(TestUnsignedIntegerType, TestConstructor) {
+  using type = cina::new_type<struct Tag, std::uint32_t>;
+  EXPECT_TRUE((std::is_constructible_v<type, std::uint8_t>));
+  EXPECT_TRUE((std::is_constructible_v<type, std::uint32_t>));
+  EXPECT_FALSE((std::is_constructible_v<type, std::uint64_t>));
+  EXPECT_FALSE((std::is_constructible_v<type, int>));
+  constexpr type a{42U};
+  static_assert(a.unwrap() == 42U);
+
+  using wide = cina::new_type<struct Tag, std::uint64_t>;
+  wide w{1U};
+  w = a;
+  EXPECT_EQ(w.unwrap(), 42U);
+
+  std::uint16_t value{7};
+  cina::new_type<struct Tag, std::uint16_t&> ref{value};
+  ref = cina::new_type<struct Tag, std::uint8_t>{std::uint8_t{9}};
+  EXPECT_EQ(value, 9);
+}
+
+TEST(TestUnsignedIntegerType, TestArithmetic) {
+  using byte_count = cina::new_type<struct Tag, std::uint8_t>;
+  using word = cina::new_type<struct Tag, std::uint16_t>;
+  constexpr byte_count a{std::uint8_t{200}};
+  constexpr byte_count b{std::uint8_t{100}};
+
+  EXPECT_TRUE(
+      (std::same_as<decltype(a + b),
+                    cina::unsigned_integer_type<struct Tag, unsigned int>>));
+  static_assert((a + b).unwrap() == 300U);
+  static_assert((b - a).unwrap() == 0U - 100U);
+  static_assert((a * b).unwrap() == 20000U);
+  static_assert((a / b).unwrap() == 2U);
+  static_assert((a % b).unwrap() == 0U);
+
+  // 65535 * 65535 overflows int; the skill multiplies in unsigned int.
+  constexpr word max{std::uint16_t{65535}};
+  static_assert((max * max).unwrap() == 65535U * 65535U);
+  word m = max;
+  m *= max;
+  EXPECT_EQ(m.unwrap(), 1U);
+
+  byte_count c = a;
+  c += b;
+  EXPECT_EQ(c.unwrap(), 44U);
+  c -= b;
+  EXPECT_EQ(c.unwrap(), 200U);
+  ++c;
+  EXPECT_EQ(c.unwrap(), 201U);
+  c--;
+  EXPECT_EQ(c.unwrap(), 200U);
+  EXPECT_LT(b, a);
+}
+
+TEST(TestUnsignedIntegerType, TestBitwise) {
+  using mask = cina::new_type<struct Tag, std::uint8_t>;
+  constexpr mask a{std::uint8_t{0b1100'1010}};
+  constexpr mask b{std::uint8_t{0b1010'0110}};
+  EXPECT_TRUE((std::same_as<decltype(a & b), mask>));
+  static_assert((a & b).unwrap() == 0b1000'0010);
+  static_assert((a | b).unwrap() == 0b1110'1110);
+  static_assert((a ^ b).unwrap() == 0b0110'1100);
+  static_assert((~a).unwrap() == 0b0011'0101);
+
+  mask c = a;
+  c &= b;
+  EXPECT_EQ(c.unwrap(), 0b1000'0010);
+  c |= mask{std::uint8_t{1}};
+  EXPECT_EQ(c.unwrap(), 0b1000'0011);
+  c ^= c;
+  EXPECT_EQ(c.unwrap(), 0);
+}
+
+TEST(TestUnsignedIntegerType, TestShift) {
+  using mask = cina::new_type<struct Tag, std::uint8_t>;
+  using word = cina::new_type<struct Tag, std::uint16_t>;
+  constexpr mask a{std::uint8_t{0b1100'1010}};
+  EXPECT_TRUE((std::same_as<decltype(a << 1), mask>));
+  static_assert((a << 1).unwrap() == 0b1001'0100);
+  static_assert((a >> 4).unwrap() == 0b1100);
+  static_assert((word{std::uint16_t{0xffff}} << 16).unwrap() == 0);
+
+  mask b = a;
+  b <<= 4;
+  EXPECT_EQ(b.unwrap(), 0b1010'0000);
+  b >>= 5U;
+  EXPECT_EQ(b.unwrap(), 0b101);
+}
+
+TEST(TestUnsignedIntegerType, TestStreams) {
+  using type = cina::new_type<struct Tag, std::uint8_t>;
+  std::ostringstream os;
+  os << type{std::uint8_t{200}};
+  EXPECT_EQ(os.str(), "200");
+}
+
+TEST(TestUnsignedIntegerType, TestHash) {
+  using type = cina::new_type<struct Tag, std::uint64_t>;
+  EXPECT_EQ(std::hash<type>{}(type{42U}), std::hash<std::uint64_t>{}(42U));
+}
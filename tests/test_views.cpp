@@ -0,0 +1,165 @@
+#include <cina.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using sample = cina::new_type<struct SampleTag, std::int16_t>;
+using meters = cina::new_type<struct MetersTag, double, cina::addition>;
+using name = cina::new_type<struct NameTag, std::string>;
+using percent = cina::range_integer<struct PercentTag, 0, 100>;
+using reference = cina::strong_type<struct ReferenceTag, int&>;
+
+enum class color : std::uint8_t { red, green, blue };
+using strong_color = cina::enumeration<struct ColorTag, color>;
+
+namespace {
+template <typename R>
+concept underlying_viewable =
+    requires(R&& range) { cina::as_underlying_span(std::forward<R>(range)); };
+
+template <typename Strong, typename R>
+concept strong_viewable = requires(R&& range) {
+  cina::as_strong_span<Strong>(std::forward<R>(range));
+};
+
+// Whether an element of the result of as_underlying_span or views::unwrap can
+// be assigned.
+template <typename R>
+concept underlying_span_writable = requires(R&& range) {
+  cina::as_underlying_span(std::forward<R>(range))[0] = {};
+};
+
+template <typename R>
+concept unwrap_writable = requires(R&& range) {
+  *std::ranges::begin(std::forward<R>(range) | cina::views::unwrap) = {};
+};
+
+auto sum(const std::span<const std::int16_t> values) -> int {
+  return std::accumulate(values.begin(), values.end(), 0);
+}
+} // namespace
+
+TEST(TestViews, TestUnwrap) {
+  std::vector<sample> samples{sample{std::int16_t{1}}, sample{std::int16_t{2}},
+                              sample{std::int16_t{3}}};
+  auto raw = samples | cina::views::unwrap;
+  EXPECT_TRUE((std::same_as<std::ranges::range_reference_t<decltype(raw)>,
+                            std::int16_t&>));
+  EXPECT_TRUE(std::ranges::random_access_range<decltype(raw)>);
+  EXPECT_EQ(std::accumulate(raw.begin(), raw.end(), 0), 6);
+
+  for (std::int16_t& value : raw) {
+    value = static_cast<std::int16_t>(value * 10);
+  }
+  EXPECT_EQ(samples[2], sample{std::int16_t{30}});
+
+  const std::vector<sample>& view = samples;
+  EXPECT_TRUE(
+      (std::same_as<std::ranges::range_reference_t<decltype(
+                        view | cina::views::unwrap)>,
+                    const std::int16_t&>));
+
+  auto generated =
+      std::views::iota(0, 3) | cina::views::wrap<meters> | cina::views::unwrap;
+  EXPECT_TRUE(
+      (std::same_as<std::ranges::range_reference_t<decltype(generated)>,
+                    double>));
+  EXPECT_EQ(generated[2], 2.0);
+
+  // Validated types yield const references, so unchecked values cannot be
+  // written through the view.
+  std::vector<percent> percents{percent{10}, percent{20}};
+  auto checked = percents | cina::views::unwrap;
+  EXPECT_TRUE((std::same_as<std::ranges::range_reference_t<decltype(checked)>,
+                            const cina::underlying_type_t<percent>&>));
+  EXPECT_EQ(checked[1], 20);
+  EXPECT_TRUE(unwrap_writable<std::vector<sample>&>);
+  EXPECT_FALSE(unwrap_writable<std::vector<percent>&>);
+  EXPECT_FALSE(unwrap_writable<std::vector<strong_color>&>);
+}
+
+TEST(TestViews, TestWrap) {
+  const std::vector<double> lengths{1.5, 2.5};
+  auto strong = lengths | cina::views::wrap<meters>;
+  EXPECT_TRUE(
+      (std::same_as<std::ranges::range_value_t<decltype(strong)>, meters>));
+  meters total{0.0};
+  for (const meters length : strong) {
+    total += length;
+  }
+  EXPECT_EQ(total, meters{4.0});
+
+  const std::array<int, 3> values{10, 200, 30};
+  auto checked = values | cina::views::wrap<percent>;
+  EXPECT_EQ(checked[0], percent{10});
+  EXPECT_THROW(static_cast<void>(checked[1]), cina::constraint_error);
+}
+
+TEST(TestViews, TestAsUnderlyingSpan) {
+  std::vector<sample> samples{sample{std::int16_t{4}}, sample{std::int16_t{5}}};
+  const std::span<std::int16_t> raw = cina::as_underlying_span(samples);
+  EXPECT_EQ(static_cast<const void*>(raw.data()), samples.data());
+  EXPECT_EQ(raw.size(), 2U);
+  EXPECT_EQ(sum(cina::as_underlying_span(samples)), 9);
+  raw[1] = 7;
+  EXPECT_EQ(samples[1], sample{std::int16_t{7}});
+
+  const std::vector<sample>& view = samples;
+  EXPECT_TRUE((std::same_as<decltype(cina::as_underlying_span(view)),
+                            std::span<const std::int16_t>>));
+
+  std::array<sample, 3> fixed{sample{std::int16_t{1}}, sample{std::int16_t{2}},
+                              sample{std::int16_t{3}}};
+  EXPECT_TRUE((std::same_as<decltype(cina::as_underlying_span(fixed)),
+                            std::span<std::int16_t, 3>>));
+
+  std::vector<name> names{name{"a"}, name{"b"}};
+  EXPECT_EQ(cina::as_underlying_span(names)[1], "b");
+
+  // Validated types are viewed read-only.
+  std::vector<percent> percents{percent{10}, percent{20}};
+  EXPECT_TRUE(
+      (std::same_as<decltype(cina::as_underlying_span(percents)),
+                    std::span<const cina::underlying_type_t<percent>>>));
+  EXPECT_EQ(cina::as_underlying_span(percents)[1], 20);
+  EXPECT_TRUE(underlying_span_writable<std::vector<sample>&>);
+  EXPECT_FALSE(underlying_span_writable<std::vector<percent>&>);
+  EXPECT_FALSE(underlying_span_writable<std::vector<strong_color>&>);
+}
+
+TEST(TestViews, TestAsStrongSpan) {
+  std::vector<std::int16_t> raw{1, 2, 3};
+  const std::span<sample> strong = cina::as_strong_span<sample>(raw);
+  EXPECT_EQ(static_cast<const void*>(strong.data()), raw.data());
+  EXPECT_EQ(strong[2], sample{std::int16_t{3}});
+  ++strong[0];
+  EXPECT_EQ(raw[0], 2);
+
+  const std::array<double, 2> lengths{1.0, 2.0};
+  EXPECT_TRUE((std::same_as<decltype(cina::as_strong_span<meters>(lengths)),
+                            std::span<const meters, 2>>));
+  EXPECT_EQ(cina::as_strong_span<meters>(lengths)[1], meters{2.0});
+}
+
+TEST(TestViews, TestConstraints) {
+  EXPECT_TRUE(underlying_viewable<std::vector<sample>&>);
+  EXPECT_TRUE(underlying_viewable<std::span<sample>>);
+  EXPECT_TRUE(underlying_viewable<std::vector<percent>&>);
+  EXPECT_FALSE(underlying_viewable<std::vector<sample>>);
+  EXPECT_FALSE(underlying_viewable<std::vector<std::int16_t>&>);
+  EXPECT_FALSE(underlying_viewable<std::vector<reference>&>);
+
+  EXPECT_TRUE((strong_viewable<sample, std::vector<std::int16_t>&>));
+  EXPECT_FALSE((strong_viewable<sample, std::vector<std::int32_t>&>));
+  EXPECT_FALSE((strong_viewable<sample, std::vector<std::int16_t>>));
+  EXPECT_FALSE((strong_viewable<percent, std::vector<std::int8_t>&>));
+  EXPECT_FALSE((strong_viewable<strong_color, std::vector<color>&>));
+}